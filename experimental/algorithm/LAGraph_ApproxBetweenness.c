@@ -0,0 +1,206 @@
+//------------------------------------------------------------------------------
+// LAGraph_ApproxBetweenness: betweenness centrality by adaptive sampling
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_ApproxBetweenness estimates the betweenness centrality of all nodes,
+// on the same scale as LAGraph_Betweenness (the exact centrality), by
+// sampling source nodes uniformly at random, with replacement.  The sources
+// are drawn in batches of batch_size nodes with LAGraph_Random_Seed and
+// LAGraph_Random_Next, and each batch is computed with LAGr_Betweenness.  The
+// sampling stops as soon as, with probability at least 1-delta,
+
+//      abs (centrality (v) - bc (v)) <= epsilon * n * (n-1)
+
+// holds for all nodes v, where bc is the exact centrality.  The number of
+// sources sampled is returned in nsamples.
+
+// For a source s drawn uniformly at random, x(s) = delta_s (v) / (n-1) is in
+// the range [0,1], where delta_s (v) is the dependency of s on v, and its
+// mean is mu = bc (v) / (n*(n-1)).  The variance of x(s) is at most mu, so
+// after k samples with mean m, Bernstein's inequality gives the bound
+
+//      abs (m - mu) <= sqrt (2*mu*L/k) + 2*L/(3*k), with L = log (2/d),
+
+// with probability at least 1-d.  Replacing mu with its upper bound gives a
+// width that depends only on m, and which increases with m, so it is
+// evaluated only for the node with the largest estimate.  Nodes of low
+// centrality have low variance, so this stops much earlier than a fixed
+// bound when the largest normalized centrality is small (as in KADABRA, by
+// Borassi and Natale).  The bound is checked after each batch, and the
+// failure probability delta/2 is split over all n nodes and all checks.  The
+// sampling also stops once the number of samples reaches the Hoeffding bound
+// k = log (4*n/delta) / (2*epsilon^2), which holds with probability at least
+// 1-delta/2 no matter what the centrality is (as in the fixed sample size of
+// Riondato and Kornaropoulos, but with the union bound over all nodes).
+
+// LAGraph_Random_Init must be called before this method.  The results are
+// reproducible for a given seed, but they depend on batch_size.  This is an
+// Advanced algorithm (G->AT is required, as for LAGr_Betweenness).
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                            \
+{                                               \
+    GrB_free (&Seed) ;                          \
+    GrB_free (&cb) ;                            \
+    LAGraph_Free ((void **) &sources, NULL) ;   \
+    LAGraph_Free ((void **) &seeds, NULL) ;     \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (&c) ;                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// default number of sources in each batch
+#define LG_BC_DEFAULT_BATCH 64
+
+int LAGraph_ApproxBetweenness
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): estimated betweeness of i
+    int64_t *nsamples,          // number of sources sampled
+    // input:
+    const LAGraph_Graph G,      // input graph
+    double epsilon,             // error bound, relative to n*(n-1)
+    double delta,               // probability that the bound fails
+    int32_t batch_size,         // # of sources in each batch (0: default)
+    uint64_t seed,              // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector c = NULL, cb = NULL, Seed = NULL ;
+    GrB_Index *sources = NULL ;
+    uint64_t *seeds = NULL ;
+    LG_ASSERT (centrality != NULL && nsamples != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    (*nsamples) = 0 ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (epsilon > 0 && epsilon < 1, GrB_INVALID_VALUE,
+        "epsilon must be in the range (0,1)") ;
+    LG_ASSERT_MSG (delta > 0 && delta < 1, GrB_INVALID_VALUE,
+        "delta must be in the range (0,1)") ;
+    LG_ASSERT_MSG (batch_size >= 0, GrB_INVALID_VALUE,
+        "batch_size must be non-negative") ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Vector_new (&c, GrB_FP64, n)) ;
+    GRB_TRY (GrB_assign (c, NULL, NULL, (double) 0, GrB_ALL, n, NULL)) ;
+    if (n <= 2)
+    {
+        // no node can be an interior node of a shortest path
+        (*centrality) = c ;
+        return (GrB_SUCCESS) ;
+    }
+
+    // kmax: # of samples for the Hoeffding bound, with probability delta/2
+    double log_n = log ((double) n) ;
+    double kmax_d = ceil ((log_n + log (4 / delta)) /
+        (2 * epsilon * epsilon)) ;
+    int64_t kmax = (int64_t) LAGRAPH_MIN (kmax_d, (double) INT64_MAX / 2) ;
+
+    int64_t ns = (batch_size == 0) ? LG_BC_DEFAULT_BATCH : batch_size ;
+    ns = LAGRAPH_MIN (ns, kmax) ;
+    int64_t nbatches = (kmax + ns - 1) / ns ;
+
+    // L: log (2/d) for the Bernstein bound, where d = delta/2 is split over
+    // all n nodes and all nbatches checks
+    double L = log_n + log ((double) nbatches) + log (4 / delta) ;
+
+    // the random source nodes of each batch are taken from Seed
+    GRB_TRY (GrB_Vector_new (&Seed, GrB_UINT64, ns)) ;
+    GRB_TRY (GrB_assign (Seed, NULL, NULL, 0, GrB_ALL, ns, NULL)) ;
+    LG_TRY (LAGraph_Random_Seed (Seed, seed, msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &sources, ns, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &seeds, ns, sizeof (uint64_t), msg)) ;
+
+    //--------------------------------------------------------------------------
+    // sample batches of sources until the error bound is met
+    //--------------------------------------------------------------------------
+
+    int64_t k = 0 ;
+    while (k < kmax)
+    {
+
+        //----------------------------------------------------------------------
+        // choose the next batch of sources
+        //----------------------------------------------------------------------
+
+        GrB_Index nseeds = ns ;
+        GRB_TRY (GrB_Vector_extractTuples (NULL, seeds, &nseeds, Seed)) ;
+        for (int64_t i = 0 ; i < ns ; i++)
+        {
+            sources [i] = seeds [i] % n ;
+        }
+        LG_TRY (LAGraph_Random_Next (Seed, msg)) ;
+
+        //----------------------------------------------------------------------
+        // c += betweenness from this batch of sources
+        //----------------------------------------------------------------------
+
+        LG_TRY (LAGr_Betweenness (&cb, G, sources, (int32_t) ns, msg)) ;
+        GRB_TRY (GrB_eWiseAdd (c, NULL, NULL, GrB_PLUS_FP64, c, cb, NULL)) ;
+        GRB_TRY (GrB_free (&cb)) ;
+        k += ns ;
+        if (k >= kmax) break ;
+
+        //----------------------------------------------------------------------
+        // check the Bernstein bound for the node with the largest estimate
+        //----------------------------------------------------------------------
+
+        // m = max (c) / (k*(n-1)), the largest normalized estimate
+        double cmax = 0 ;
+        GRB_TRY (GrB_reduce (&cmax, NULL, GrB_MAX_MONOID_FP64, c, NULL)) ;
+        double m = cmax / ((double) k * (double) (n-1)) ;
+        // mu is at most (sqrt (a/2) + sqrt (m + 7a/6))^2, with a = L/k
+        double a = L / (double) k ;
+        double mu = sqrt (a/2) + sqrt (m + 7*a/6) ;
+        mu = LAGRAPH_MIN (mu * mu, 1) ;
+        double width = sqrt (2 * mu * a) + 2 * a / 3 ;
+        if (width <= epsilon) break ;
+    }
+
+    //--------------------------------------------------------------------------
+    // scale the result: centrality = c * n / k
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_apply (c, NULL, NULL, GrB_TIMES_FP64, c,
+        (double) n / (double) k, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    (*centrality) = c ;
+    (*nsamples) = k ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,232 @@
+//------------------------------------------------------------------------------
+// LAGraph_ApproxTriangleCount: estimate the # of triangles by edge sampling
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_ApproxTriangleCount estimates the number of triangles in an
+// undirected graph by edge sparsification (DOULION, by Tsourakakis, Kang,
+// Miller, and Faloutsos, KDD'09).  Each edge is kept with probability p, the
+// triangles in the sparsified graph are counted, and the count is scaled by
+// 1/p^3.  Each edge (i,j) is kept if a hash of i, j, and the seed is less
+// than p times 2^64, so the result is reproducible for a given seed.  The
+// hashes are computed and the edges selected in parallel by GraphBLAS.
+
+// A confidence interval is also returned.  A triangle survives with
+// probability p^3, and two triangles that share an edge both survive with
+// probability p^5, so the variance of the estimate X = T'/p^3, where T' is the
+// number of triangles in the sparsified graph, is
+
+//      Var (X) = T (1-p^3)/p^3 + 2 P (1-p)/p
+
+// where T is the number of triangles and P is the number of pairs of
+// triangles that share an edge, P = sum (t_e*(t_e-1)/2) for the number t_e of
+// triangles on each edge e.  Estimating T and P from the sparsified graph
+// fails when it has few or no triangles: the estimated variance is then zero,
+// and so is the interval.  Instead, the variance is bounded in terms of T
+// alone.  Each edge is in at most dmax-2 other triangles, where dmax is the
+// largest degree of G, so P <= 3 T (dmax-2) / 2, and
+
+//      Var (X) <= c T, where c = (1-p^3)/p^3 + 3 (dmax-2) (1-p)/p
+
+// The interval holds all T with |X-T| <= z sqrt (c T) (z = 1.96 for a 95%
+// interval, by the normal approximation), which is
+
+//      [ ((sqrt (a^2 + 4X) - a) / 2)^2 , ((sqrt (a^2 + 4X) + a) / 2)^2 ]
+
+// with a = z sqrt (c).  This does not vanish when T' is zero: the interval is
+// then [0, a^2].  The lower end is at least T', since every triangle in the
+// sparsified graph is also in G, and the upper end is at most the largest
+// possible number of triangles of a graph with e edges and a maximum degree
+// dmax, min ((2e)^(3/2)/6, e (dmax-1)/3).  With p = 1 the interval is [T,T].
+
+// The graph must be undirected, or have a symmetric structure.  Self-edges are
+// ignored.  A GrB_Matrix of size O(e) holds the hashes of the e edges of the
+// strictly lower triangular part of G->A.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                            \
+{                                               \
+    GrB_free (&L) ;                             \
+    GrB_free (&H) ;                             \
+    GrB_free (&hash_op) ;                       \
+    GrB_free (&t) ;                             \
+    GrB_free (&deg) ;                           \
+    GrB_free (&E) ;                             \
+    LAGraph_Delete (&Gs, NULL) ;                \
+}
+
+#define LG_FREE_ALL LG_FREE_WORK
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LG_edge_hash: z = a hash of the edge (i,j) and the seed y
+//------------------------------------------------------------------------------
+
+// splitmix64 finalizer
+static inline uint64_t LG_mix (uint64_t x)
+{
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9 ;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EB ;
+    return (x ^ (x >> 31)) ;
+}
+
+static void LG_edge_hash (void *z, const void *x,
+    const GrB_Index i, const GrB_Index j, const void *y)
+{
+    uint64_t seed = (*((const uint64_t *) y)) ;
+    uint64_t h = LG_mix (seed ^ (i * 0x9E3779B97F4A7C15)) ;
+    (*((uint64_t *) z)) = LG_mix (h ^ j) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_ApproxTriangleCount
+//------------------------------------------------------------------------------
+
+int LAGraph_ApproxTriangleCount
+(
+    // output:
+    double *estimate,       // estimated # of triangles in G
+    double *ci_low,         // lower end of the confidence interval
+    double *ci_high,        // upper end of the confidence interval
+    // input:
+    const LAGraph_Graph G,  // input graph
+    double p,               // probability of keeping each edge, in (0,1]
+    double z,               // half-width of the interval, in std. deviations
+    uint64_t seed,          // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix L = NULL, E = NULL, H = NULL ;
+    GrB_Vector t = NULL, deg = NULL ;
+    GrB_IndexUnaryOp hash_op = NULL ;
+    LAGraph_Graph Gs = NULL ;
+    LG_ASSERT (estimate != NULL && ci_low != NULL && ci_high != NULL,
+        GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)),
+        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
+        "G->A must be known to be symmetric") ;
+    LG_ASSERT_MSG (p > 0 && p <= 1, GrB_INVALID_VALUE,
+        "p must be in the range (0,1]") ;
+    LG_ASSERT_MSG (z >= 0, GrB_INVALID_VALUE, "z must be non-negative") ;
+
+    //--------------------------------------------------------------------------
+    // L = tril (A,-1), one entry for each edge
+    //--------------------------------------------------------------------------
+
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_new (&L, GrB_BOOL, n, n)) ;
+    GRB_TRY (GrB_select (L, NULL, NULL, GrB_TRIL, G->A, (int64_t) (-1), NULL)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, L)) ;
+
+    // dmax = the largest degree of G, excluding self-edges
+    int64_t dmax = 0 ;
+    GRB_TRY (GrB_Vector_new (&deg, GrB_INT64, n)) ;
+    GRB_TRY (GrB_reduce (deg, NULL, NULL, GrB_PLUS_MONOID_INT64, L, NULL)) ;
+    GRB_TRY (GrB_reduce (deg, NULL, GrB_PLUS_INT64, GrB_PLUS_MONOID_INT64, L,
+        GrB_DESC_T0)) ;
+    GRB_TRY (GrB_reduce (&dmax, NULL, GrB_MAX_MONOID_INT64, deg, NULL)) ;
+    GRB_TRY (GrB_free (&deg)) ;
+
+    //--------------------------------------------------------------------------
+    // keep each edge with probability p
+    //--------------------------------------------------------------------------
+
+    if (p < 1 && nvals > 0)
+    {
+        // H(i,j) = hash of (i,j) and the seed, for each edge of L
+        GRB_TRY (GrB_IndexUnaryOp_new (&hash_op, LG_edge_hash, GrB_UINT64,
+            /* aij: ignored */ GrB_BOOL, /* y: seed */ GrB_UINT64)) ;
+        GRB_TRY (GrB_Matrix_new (&H, GrB_UINT64, n, n)) ;
+        GRB_TRY (GrB_apply (H, NULL, NULL, hash_op, L, seed, NULL)) ;
+
+        // H = the edges whose hash, scaled to [0,1), is less than p
+        uint64_t threshold = (uint64_t) (p * 18446744073709551616.0) ;
+        GRB_TRY (GrB_select (H, NULL, NULL, GrB_VALUELT_UINT64, H, threshold,
+            NULL)) ;
+
+        // L<struct(H),replace> = true
+        GRB_TRY (GrB_assign (L, H, NULL, (bool) true, GrB_ALL, n, GrB_ALL, n,
+            GrB_DESC_RS)) ;
+        GRB_TRY (GrB_free (&H)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the triangles on each edge of the sparsified graph
+    //--------------------------------------------------------------------------
+
+    // Gs = the undirected graph L+L'
+    GRB_TRY (GrB_eWiseAdd (L, NULL, NULL, GrB_LOR, L, L, GrB_DESC_T1)) ;
+    LG_TRY (LAGraph_New (&Gs, &L, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    LG_TRY (LAGraph_Cached_NSelfEdges (Gs, msg)) ;
+
+    // E(i,j) = # of triangles on the edge (i,j) of Gs
+    LAGr_TriangleCount_Method method = LAGr_TriangleCount_Sandia_LUT ;
+    LAGr_TriangleCount_Presort presort = LAGr_TriangleCount_NoSort ;
+    LG_TRY (LAGr_TriangleCountLocal (&t, &E, Gs, &method, &presort, msg)) ;
+
+    // s1 = sum (E), where each edge appears twice in E
+    int64_t s1 = 0 ;
+    GRB_TRY (GrB_reduce (&s1, NULL, GrB_PLUS_MONOID_INT64, E, NULL)) ;
+
+    // each triangle is counted on its 3 edges, twice each
+    double ntri = (double) (s1 / 6) ;
+
+    //--------------------------------------------------------------------------
+    // compute the estimate and its confidence interval
+    //--------------------------------------------------------------------------
+
+    double p3 = p * p * p ;
+    double x = ntri / p3 ;
+    // Var (X) <= c*T
+    double c = (1 - p3) / p3
+        + 3 * (double) LAGRAPH_MAX (dmax - 2, 0) * (1 - p) / p ;
+    double a = z * sqrt (c) ;
+    double lo = x, hi = x ;
+    if (a > 0)
+    {
+        // all T with |x-T| <= a*sqrt(T)
+        double root = sqrt (a * a + 4 * x) ;
+        lo = (root - a) / 2 ; lo = lo * lo ;
+        hi = (root + a) / 2 ; hi = hi * hi ;
+        // the most triangles a graph with e edges and max degree dmax can have
+        double e = (double) nvals ;
+        double tmax = LAGRAPH_MIN (pow (2 * e, 1.5) / 6,
+            e * (double) LAGRAPH_MAX (dmax - 1, 0) / 3) ;
+        hi = LAGRAPH_MAX (LAGRAPH_MIN (hi, tmax), x) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    (*estimate) = x ;
+    (*ci_low) = LAGRAPH_MAX (lo, ntri) ;
+    (*ci_high) = hi ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,264 @@
+//------------------------------------------------------------------------------
+// LAGraph_BidirectionalBFS: point-to-point breadth-first search
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_BidirectionalBFS finds the # of edges on a shortest path from the
+// node src to the node dest, and optionally the path itself.  Two searches
+// are done at the same time: a forward BFS from src using G->A, and a
+// backward BFS from dest using G->AT.  At each step, the search with the
+// smaller frontier is advanced by one level.  The method stops as soon as the
+// two frontiers meet, so that only a small part of the graph is explored when
+// src and dest are close together.
+
+// On output, distance is the # of edges on the shortest path, or -1 if dest
+// cannot be reached from src.  If path is not NULL, it is returned as a
+// GrB_INT64 vector of size distance+1, where path (k) is the kth node on a
+// shortest path: path (0) = src and path (distance) = dest.  If dest cannot be
+// reached from src, the path is returned as a vector of size zero.
+
+// This is an Advanced algorithm.  G->AT is required if G is directed and its
+// structure is not known to be symmetric; it is not computed if not present.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                        \
+{                                           \
+    GrB_free (&(q [0])) ;                   \
+    GrB_free (&(q [1])) ;                   \
+    GrB_free (&(visited [0])) ;             \
+    GrB_free (&(visited [1])) ;             \
+    GrB_free (&meet) ;                      \
+    LAGraph_Free ((void **) &I, NULL) ;     \
+    LAGraph_Free ((void **) &X, NULL) ;     \
+    LAGraph_Free ((void **) &Path, NULL) ;  \
+}
+
+#define LG_FREE_ALL                         \
+{                                           \
+    LG_FREE_WORK ;                          \
+    GrB_free (&P) ;                         \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_BidirectionalBFS
+(
+    // outputs:
+    int64_t *distance,          // # of edges on a shortest path from src to
+                                // dest, or -1 if dest is not reachable
+    GrB_Vector *path,           // if non-NULL, path (k) is the kth node on a
+                                // shortest path from src to dest
+    // inputs:
+    const LAGraph_Graph G,      // input graph
+    GrB_Index src,              // source node
+    GrB_Index dest,             // destination node
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector q [2] = { NULL, NULL } ;         // forward/backward frontiers
+    GrB_Vector visited [2] = { NULL, NULL } ;   // forward/backward parents
+    GrB_Vector meet = NULL ;        // nodes where the frontiers meet
+    GrB_Vector P = NULL ;           // the output path
+    GrB_Index *I = NULL ;
+    bool *X = NULL ;
+    int64_t *Path = NULL ;
+
+    bool compute_path = (path != NULL) ;
+    if (compute_path) (*path) = NULL ;
+    LG_ASSERT (distance != NULL, GrB_NULL_POINTER) ;
+    (*distance) = -1 ;
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Matrix AT ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    LG_ASSERT_MSG (src < n && dest < n, GrB_INVALID_INDEX,
+        "invalid source or destination node") ;
+
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE)
+    {
+        // A and A' have the same structure
+        AT = A ;
+    }
+    else
+    {
+        // A and A' differ
+        AT = G->AT ;
+        LG_ASSERT_MSG (AT != NULL, LAGRAPH_NOT_CACHED, "G->AT is required") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    // the forward search (k = 0) starts at src and traverses the edges of A;
+    // the backward search (k = 1) starts at dest and traverses the edges of AT
+    GrB_Matrix M [2] = { A, AT } ;
+    GrB_Index root [2] = { src, dest } ;
+    GrB_Index nq [2] = { 1, 1 } ;       // size of each frontier
+    int64_t depth [2] = { 0, 0 } ;      // level of each frontier
+
+    GrB_Semiring semiring ;
+    GrB_Type type ;
+    if (compute_path)
+    {
+        // the parents of each search are needed to construct the path
+        type = GrB_INT64 ;
+        #if LAGRAPH_SUITESPARSE
+        semiring = GxB_ANY_SECONDI_INT64 ;
+        #else
+        semiring = GrB_MIN_FIRST_SEMIRING_INT64 ;
+        #endif
+    }
+    else
+    {
+        // only the distance is needed
+        type = GrB_BOOL ;
+        semiring = LAGraph_any_one_bool ;
+    }
+
+    for (int k = 0 ; k <= 1 ; k++)
+    {
+        // q [k] (root [k]) = root [k], and visited [k] (root [k]) = root [k]
+        GRB_TRY (GrB_Vector_new (&(q [k]), type, n)) ;
+        GRB_TRY (GrB_Vector_new (&(visited [k]), type, n)) ;
+        GRB_TRY (GrB_Vector_setElement (q [k], root [k], root [k])) ;
+        GRB_TRY (GrB_Vector_setElement (visited [k], root [k], root [k])) ;
+        #if LAGRAPH_SUITESPARSE
+        GRB_TRY (GxB_set (q [k], GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        #endif
+    }
+    GRB_TRY (GrB_Vector_new (&meet, GrB_BOOL, n)) ;
+
+    //--------------------------------------------------------------------------
+    // advance the smaller frontier until the two frontiers meet
+    //--------------------------------------------------------------------------
+
+    GrB_Index nmeet = (src == dest) ? 1 : 0 ;
+    GrB_Index m = src ;                 // a node on the shortest path
+
+    while (nmeet == 0)
+    {
+
+        //----------------------------------------------------------------------
+        // q [k]<!visited [k]> = q [k] * M [k], for the smaller frontier
+        //----------------------------------------------------------------------
+
+        int k = (nq [1] < nq [0]) ? 1 : 0 ;
+        #if !LAGRAPH_SUITESPARSE
+        if (compute_path)
+        {
+            // convert all stored values in the frontier to their indices
+            GRB_TRY (GrB_apply (q [k], NULL, NULL, GrB_ROWINDEX_INT64, q [k],
+                0, NULL)) ;
+        }
+        #endif
+        GRB_TRY (GrB_vxm (q [k], visited [k], NULL, semiring, q [k], M [k],
+            GrB_DESC_RSC)) ;
+        GRB_TRY (GrB_Vector_nvals (&(nq [k]), q [k])) ;
+        if (nq [k] == 0)
+        {
+            // dest is not reachable from src
+            break ;
+        }
+        depth [k]++ ;
+
+        // visited [k]<s(q [k])> = q [k]
+        GRB_TRY (GrB_assign (visited [k], q [k], NULL, q [k], GrB_ALL, n,
+            GrB_DESC_S)) ;
+
+        //----------------------------------------------------------------------
+        // check if the two frontiers meet
+        //----------------------------------------------------------------------
+
+        // No node was visited by both searches before this step, so any node
+        // in the new frontier q [k] that has been visited by the other search
+        // must be in its current frontier.  Each such node is on a shortest
+        // path of length depth [0] + depth [1].
+        GRB_TRY (GrB_eWiseMult (meet, NULL, NULL, GrB_FIRST_BOOL, q [0], q [1],
+            NULL)) ;
+        GRB_TRY (GrB_Vector_nvals (&nmeet, meet)) ;
+        if (nmeet > 0)
+        {
+            // pick any node where the two frontiers meet
+            LG_TRY (LAGraph_Malloc ((void **) &I, nmeet, sizeof (GrB_Index),
+                msg)) ;
+            LG_TRY (LAGraph_Malloc ((void **) &X, nmeet, sizeof (bool), msg)) ;
+            GRB_TRY (GrB_Vector_extractTuples_BOOL (I, X, &nmeet, meet)) ;
+            m = I [0] ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the path, if requested
+    //--------------------------------------------------------------------------
+
+    int64_t dist = (nmeet > 0) ? (depth [0] + depth [1]) : (-1) ;
+    if (compute_path)
+    {
+        int64_t len = dist + 1 ;
+        GRB_TRY (GrB_Vector_new (&P, GrB_INT64, len)) ;
+        if (len > 0)
+        {
+            LAGraph_Free ((void **) &I, NULL) ;
+            LG_TRY (LAGraph_Malloc ((void **) &I, len, sizeof (GrB_Index),
+                msg)) ;
+            LG_TRY (LAGraph_Malloc ((void **) &Path, len, sizeof (int64_t),
+                msg)) ;
+            // follow the forward parents from m back to src
+            int64_t node = m ;
+            Path [depth [0]] = m ;
+            for (int64_t d = depth [0] - 1 ; d >= 0 ; d--)
+            {
+                GRB_TRY (GrB_Vector_extractElement_INT64 (&node, visited [0],
+                    node)) ;
+                Path [d] = node ;
+            }
+            // follow the backward parents from m forward to dest
+            node = m ;
+            for (int64_t d = depth [0] + 1 ; d < len ; d++)
+            {
+                GRB_TRY (GrB_Vector_extractElement_INT64 (&node, visited [1],
+                    node)) ;
+                Path [d] = node ;
+            }
+            for (int64_t d = 0 ; d < len ; d++)
+            {
+                I [d] = d ;
+            }
+            GRB_TRY (GrB_Vector_build_INT64 (P, I, Path, len, NULL)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*distance) = dist ;
+    if (compute_path) (*path) = P ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
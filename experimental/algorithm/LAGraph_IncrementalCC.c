@@ -0,0 +1,427 @@
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC: connected components under edge insertions
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// An LAGraph_IncrementalCC object holds the connected components of an
+// undirected graph as a forest of parent pointers, so that a stream of edge
+// insertions can be handled without recomputing the components of the whole
+// graph with LAGr_ConnectedComponents.  Edge deletions are not supported.
+
+// The forest satisfies parent [i] <= i for all nodes i, so the root of each
+// tree (with parent [r] == r) is the smallest node in its component, which is
+// the same representative that LG_CC_FastSV6 selects.  The forest is never
+// cyclic, since hooking and path compression only ever decrease parent [i].
+
+// LAGraph_IncrementalCC_Insert adds a batch of edges in rounds, each with two
+// parallel phases.  The first phase finds the roots ru and rv of the two
+// endpoints of each edge, without modifying the forest.  The second phase
+// hooks the larger root onto the smaller one for each edge with ru != rv, and
+// compresses the paths from each endpoint to its root (pointer jumping).  The
+// two phases write to disjoint entries of the parent array: the hooks modify
+// only the roots found in the first phase, and path compression modifies only
+// the non-roots.  If several edges hook the same root, an atomic min keeps the
+// smallest of their other roots, so every round hooks each root that has a
+// smaller neighboring root onto the smallest one.  A root shared by many
+// edges of the batch (a hub) is thus hooked once, and the edges that lost the
+// race are joined in the next round, rather than one edge per round.  The
+// rounds stop when the endpoints of every edge share the same root.  The work
+// is proportional to the number of edges in the batch, times the number of
+// rounds and the depth of the trees it touches.
+
+// Nodes not touched by a batch are not compressed, and so the trees can grow
+// deeper over many batches.  LAGraph_IncrementalCC_Component compresses all
+// paths, in O(n) time.
+
+//------------------------------------------------------------------------------
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// the minimum number of edges (or nodes) for each thread
+#define CHUNK 1024
+
+//------------------------------------------------------------------------------
+// LG_cc_root: find the root of node i
+//------------------------------------------------------------------------------
+
+static inline int64_t LG_cc_root (const int64_t *parent, int64_t i)
+{
+    while (parent [i] != i)
+    {
+        i = parent [i] ;
+    }
+    return (i) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_cc_compress: compress the path from node i to its root r
+//------------------------------------------------------------------------------
+
+// All nodes on the path are non-roots with the same root r, so any other
+// thread that modifies parent [i] for a node on this path also sets it to r.
+
+static inline void LG_cc_compress (int64_t *parent, int64_t i, int64_t r)
+{
+    while (i != r)
+    {
+        int64_t next ;
+        #pragma omp atomic read
+        next = parent [i] ;
+        #pragma omp atomic write
+        parent [i] = r ;
+        i = next ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// LG_cc_hook: parent [hi] = min (parent [hi], lo), atomically
+//------------------------------------------------------------------------------
+
+static inline void LG_cc_hook (int64_t *parent, int64_t hi, int64_t lo)
+{
+    #if defined ( _OPENMP ) && ( _OPENMP >= 202011 )
+    {
+        // OpenMP 5.1 or later
+        #pragma omp atomic compare
+        if (lo < parent [hi]) { parent [hi] = lo ; }
+    }
+    #elif defined ( __GNUC__ )
+    {
+        // gcc, clang, and icx: compare-and-swap until lo is not smaller
+        int64_t cur = __atomic_load_n (&(parent [hi]), __ATOMIC_RELAXED) ;
+        while (lo < cur && !__atomic_compare_exchange_n (&(parent [hi]), &cur,
+            lo, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) ;
+    }
+    #else
+    {
+        #pragma omp critical (LG_cc_hook)
+        if (lo < parent [hi]) { parent [hi] = lo ; }
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC_New: construct the components of a graph
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&C) ;                                 \
+    LAGraph_Free ((void **) &W, NULL) ;             \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    LAGraph_IncrementalCC_Delete (cc, NULL) ;       \
+}
+
+int LAGraph_IncrementalCC_New
+(
+    // output:
+    LAGraph_IncrementalCC *cc,  // the connected components of G
+    // input:
+    const LAGraph_Graph G,      // input graph (symmetric structure required)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector C = NULL ;
+    GrB_Index *W = NULL ;
+    LG_ASSERT (cc != NULL, GrB_NULL_POINTER) ;
+    (*cc) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)),
+        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
+        "G->A must be known to be symmetric") ;
+
+    //--------------------------------------------------------------------------
+    // find the connected components of G
+    //--------------------------------------------------------------------------
+
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    LG_TRY (LAGr_ConnectedComponents (&C, G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // construct the object
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Calloc ((void **) cc, 1,
+        sizeof (struct LAGraph_IncrementalCC_struct), msg)) ;
+    (*cc)->n = n ;
+    LG_TRY (LAGraph_Malloc ((void **) &((*cc)->parent), n, sizeof (int64_t),
+        msg)) ;
+    int64_t *restrict parent = (*cc)->parent ;
+    LG_TRY (LAGraph_Malloc ((void **) &W, n, sizeof (GrB_Index), msg)) ;
+    nvals = n ;
+    GRB_TRY (GrB_Vector_extractTuples_INT64 (W, parent, &nvals, C)) ;
+    LG_ASSERT (nvals == n, GrB_INVALID_OBJECT) ;
+    GRB_TRY (GrB_free (&C)) ;
+
+    //--------------------------------------------------------------------------
+    // relabel each component with its smallest node
+    //--------------------------------------------------------------------------
+
+    // The representative of each component is already its smallest node if
+    // LG_CC_FastSV6 is used, but this is not required of LG_CC_Boruvka.
+    // W [s] becomes the smallest node in the component with representative s.
+
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        W [i] = n ;
+    }
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        int64_t s = parent [i] ;
+        if (W [s] == n) W [s] = i ;
+    }
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        parent [i] = W [parent [i]] ;
+    }
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC_Insert: insert a batch of edges
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                \
+{                                                   \
+    LAGraph_Free ((void **) &R, NULL) ;             \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL LG_FREE_WORK
+
+int LAGraph_IncrementalCC_Insert
+(
+    // input/output:
+    LAGraph_IncrementalCC cc,   // connected components, updated on output
+    // input:
+    const GrB_Index *I,         // the edges (I [e], J [e]) are inserted,
+    const GrB_Index *J,         // for e = 0 to nedges-1
+    GrB_Index nedges,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    int64_t *R = NULL ;
+    LG_ASSERT (cc != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (cc->parent != NULL || cc->n == 0, GrB_INVALID_OBJECT) ;
+    cc->nrounds = 0 ;
+    if (nedges == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    LG_ASSERT (I != NULL && J != NULL, GrB_NULL_POINTER) ;
+
+    const int64_t n = cc->n ;
+    const int64_t ne = nedges ;
+    int64_t *restrict parent = cc->parent ;
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = nthreads_outer * nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, ne / CHUNK) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    int64_t nbad = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nbad)
+    for (int64_t e = 0 ; e < ne ; e++)
+    {
+        nbad += (I [e] >= n || J [e] >= n) ;
+    }
+    LG_ASSERT_MSG (nbad == 0, GrB_INDEX_OUT_OF_BOUNDS,
+        "edge endpoints must be in the range 0 to n-1") ;
+
+    // R [2*e] and R [2*e+1] are the roots of the endpoints of edge e
+    LG_TRY (LAGraph_Malloc ((void **) &R, 2*ne, sizeof (int64_t), msg)) ;
+
+    //--------------------------------------------------------------------------
+    // hook the roots of each edge, until all edges are within a component
+    //--------------------------------------------------------------------------
+
+    int64_t nhooks ;
+    do
+    {
+
+        //----------------------------------------------------------------------
+        // find the roots of the endpoints of each edge
+        //----------------------------------------------------------------------
+
+        nhooks = 0 ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:nhooks)
+        for (int64_t e = 0 ; e < ne ; e++)
+        {
+            int64_t ru = LG_cc_root (parent, I [e]) ;
+            int64_t rv = LG_cc_root (parent, J [e]) ;
+            R [2*e  ] = ru ;
+            R [2*e+1] = rv ;
+            nhooks += (ru != rv) ;
+        }
+
+        if (nhooks > 0) cc->nrounds++ ;
+
+        //----------------------------------------------------------------------
+        // hook the larger root onto the smaller, and compress the paths
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (int64_t e = 0 ; e < ne ; e++)
+        {
+            int64_t ru = R [2*e  ] ;
+            int64_t rv = R [2*e+1] ;
+            if (ru != rv)
+            {
+                int64_t hi = LAGRAPH_MAX (ru, rv) ;
+                int64_t lo = LAGRAPH_MIN (ru, rv) ;
+                LG_cc_hook (parent, hi, lo) ;
+            }
+            LG_cc_compress (parent, I [e], ru) ;
+            LG_cc_compress (parent, J [e], rv) ;
+        }
+
+    }
+    while (nhooks > 0) ;
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC_Component: return the component vector
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                \
+{                                                   \
+    LAGraph_Free ((void **) &W, NULL) ;             \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (component) ;                          \
+}
+
+int LAGraph_IncrementalCC_Component
+(
+    // output:
+    GrB_Vector *component,      // component(i)=s if node i is in the
+                                // component whose smallest node is s
+    // input/output:
+    LAGraph_IncrementalCC cc,   // all paths are compressed on output
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *W = NULL ;
+    LG_ASSERT (component != NULL, GrB_NULL_POINTER) ;
+    (*component) = NULL ;
+    LG_ASSERT (cc != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (cc->parent != NULL || cc->n == 0, GrB_INVALID_OBJECT) ;
+
+    const int64_t n = cc->n ;
+    int64_t *restrict parent = cc->parent ;
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = nthreads_outer * nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, n / CHUNK) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // compress all paths
+    //--------------------------------------------------------------------------
+
+    // W [i] = root of node i, found without modifying the forest
+    LG_TRY (LAGraph_Malloc ((void **) &W, n, sizeof (GrB_Index), msg)) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        W [i] = LG_cc_root (parent, i) ;
+    }
+
+    // parent [i] = W [i], and W [i] = i for GrB_Vector_build
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        parent [i] = W [i] ;
+        W [i] = i ;
+    }
+
+    //--------------------------------------------------------------------------
+    // component = parent
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Vector_new (component, GrB_INT64, n)) ;
+    // the indices W have no duplicates, so the dup operator is not used
+    GRB_TRY (GrB_Vector_build_INT64 (*component, W, parent, n,
+        GrB_PLUS_INT64)) ;
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC_Delete: free an LAGraph_IncrementalCC object
+//------------------------------------------------------------------------------
+
+int LAGraph_IncrementalCC_Delete
+(
+    // input/output:
+    LAGraph_IncrementalCC *cc,  // the object to free; set to NULL on output
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    if (cc == NULL || (*cc) == NULL)
+    {
+        // success: nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    LAGraph_Free ((void **) &((*cc)->parent), NULL) ;
+    LAGraph_Free ((void **) cc, NULL) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,159 @@
+//------------------------------------------------------------------------------
+// LAGraph_KHopNeighborhood: all nodes within k hops of a set of seed nodes
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_KHopNeighborhood finds all nodes that can be reached in at most k
+// hops from any of the nodes in the seeds array.  It is a BFS from all of the
+// seeds at once that stops after k levels.  Only the push step of
+// LG_BreadthFirstSearch_SSGrB is used (q<!visited> = q*A, with a sparse q), so
+// the work done is bounded by the # of edges incident on the neighborhood, not
+// by the size of the graph.
+
+// On output, level is a sparse GrB_INT64 vector of size n, where level (i) is
+// the # of edges on a shortest path from any seed to node i.  Only nodes
+// within k hops of the seeds appear in level.  The seeds themselves have level
+// zero, and duplicate seeds are ignored.
+
+// If subgraph is not NULL, the subgraph of G->A induced by the neighborhood
+// is also returned.  If the neighborhood has m nodes, subgraph is m-by-m, and
+// its kth row and column correspond to the kth entry in the level vector, in
+// ascending order of node index (as returned by GrB_Vector_extractTuples).
+
+// This is a Basic algorithm: no cached properties of G are required.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                        \
+{                                           \
+    GrB_free (&q) ;                         \
+    LAGraph_Free ((void **) &I, NULL) ;     \
+}
+
+#define LG_FREE_ALL                         \
+{                                           \
+    LG_FREE_WORK ;                          \
+    GrB_free (&v) ;                         \
+    GrB_free (&S) ;                         \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_KHopNeighborhood
+(
+    // outputs:
+    GrB_Vector *level,          // level (i) = # of hops from the seeds to
+                                // node i, for all nodes within k hops
+    GrB_Matrix *subgraph,       // if non-NULL, the subgraph of G->A induced
+                                // by the nodes in the neighborhood
+    // inputs:
+    const LAGraph_Graph G,      // input graph
+    const GrB_Index *seeds,     // seed nodes
+    int64_t nseeds,             // # of seed nodes
+    int64_t k,                  // maximum # of hops
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector q = NULL ;           // the current frontier
+    GrB_Vector v = NULL ;           // the level vector
+    GrB_Matrix S = NULL ;           // the induced subgraph
+    GrB_Index *I = NULL ;
+
+    LG_ASSERT (level != NULL, GrB_NULL_POINTER) ;
+    (*level) = NULL ;
+    bool compute_subgraph = (subgraph != NULL) ;
+    if (compute_subgraph) (*subgraph) = NULL ;
+    LG_ASSERT (seeds != NULL || nseeds == 0, GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (nseeds >= 0 && k >= 0, GrB_INVALID_VALUE,
+        "nseeds and k must be >= 0") ;
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    for (int64_t i = 0 ; i < nseeds ; i++)
+    {
+        LG_ASSERT_MSG (seeds [i] < n, GrB_INVALID_INDEX, "invalid seed node") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    // q (seeds) = true and v (seeds) = 0
+    GRB_TRY (GrB_Vector_new (&q, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&v, GrB_INT64, n)) ;
+    #if LAGRAPH_SUITESPARSE
+    GRB_TRY (GxB_set (q, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (v, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    #endif
+    for (int64_t i = 0 ; i < nseeds ; i++)
+    {
+        GRB_TRY (GrB_Vector_setElement (q, true, seeds [i])) ;
+        GRB_TRY (GrB_Vector_setElement (v, 0, seeds [i])) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // BFS for at most k levels, using only the push step
+    //--------------------------------------------------------------------------
+
+    GrB_Index nq = nseeds ;
+    for (int64_t hop = 1 ; hop <= k && nq > 0 ; hop++)
+    {
+        // push (saxpy-based vxm):  q<!v> = q*A
+        GRB_TRY (GrB_vxm (q, v, NULL, LAGraph_any_one_bool, q, A,
+            GrB_DESC_RSC)) ;
+        GRB_TRY (GrB_Vector_nvals (&nq, q)) ;
+        // v<s(q)> = hop
+        GRB_TRY (GrB_assign (v, q, NULL, hop, GrB_ALL, n, GrB_DESC_S)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // extract the induced subgraph, if requested
+    //--------------------------------------------------------------------------
+
+    if (compute_subgraph)
+    {
+        GrB_Index m ;
+        GRB_TRY (GrB_Vector_nvals (&m, v)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (m, 1),
+            sizeof (GrB_Index), msg)) ;
+        GRB_TRY (GrB_Vector_extractTuples_INT64 (I, NULL, &m, v)) ;
+        GrB_Type type ;
+        char typename [LAGRAPH_MAX_NAME_LEN] ;
+        LG_TRY (LAGraph_Matrix_TypeName (typename, A, msg)) ;
+        LG_TRY (LAGraph_TypeFromName (&type, typename, msg)) ;
+        // S = A (I,I)
+        GRB_TRY (GrB_Matrix_new (&S, type, m, m)) ;
+        GRB_TRY (GrB_extract (S, NULL, NULL, A, I, m, I, m, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*level) = v ;
+    if (compute_subgraph) (*subgraph) = S ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
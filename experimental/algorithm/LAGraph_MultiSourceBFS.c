@@ -0,0 +1,347 @@
+//------------------------------------------------------------------------------
+// LAGraph_MultiSourceBFS: breadth-first search from many sources at once
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_MultiSourceBFS computes ns breadth-first searches at the same time,
+// one from each node in the sources array.  The frontiers of all the searches
+// are held as the rows of a single ns-by-n sparse matrix Q, and each level of
+// all the searches is computed with a single GrB_mxm, in the same manner as
+// the BFS stage of LAGr_Betweenness.  The results are returned as ns-by-n
+// matrices, where row i holds the result of the BFS from sources [i]:
+
+//      level (i,j) = # of edges on the shortest path from sources [i] to j
+//      parent (i,j) = parent of j in the BFS tree rooted at sources [i];
+//          parent (i, sources [i]) = sources [i]
+
+// If node j is not reachable from sources [i], then level (i,j) and
+// parent (i,j) are not present.  Either level or parent may be NULL, but not
+// both.  The sources may contain duplicates.
+
+// This is an Advanced algorithm.  If G->AT (for a directed graph with an
+// unsymmetric structure) and G->out_degree are present, direction
+// optimization is used, with the push/pull choice made for the whole batch at
+// each level, using the same heuristic as LG_BreadthFirstSearch_SSGrB applied
+// to the total frontier size and the total # of edges incident on it.
+// Otherwise, a push-only method is used.  G->AT and G->out_degree are not
+// computed if not present.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                        \
+{                                           \
+    GrB_free (&Q) ;                         \
+    GrB_free (&w) ;                         \
+    LAGraph_Free ((void **) &I, NULL) ;     \
+    LAGraph_Free ((void **) &X, NULL) ;     \
+}
+
+#define LG_FREE_ALL                         \
+{                                           \
+    LG_FREE_WORK ;                          \
+    GrB_free (&Pi) ;                        \
+    GrB_free (&V) ;                         \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_MultiSourceBFS
+(
+    // outputs:
+    GrB_Matrix *level,          // if non-NULL, level (i,j) is the level of
+                                // node j in the BFS from sources [i]
+    GrB_Matrix *parent,         // if non-NULL, parent (i,j) is the parent of
+                                // node j in the BFS from sources [i]
+    // inputs:
+    const LAGraph_Graph G,      // input graph
+    const GrB_Index *sources,   // source nodes of each BFS
+    int64_t ns,                 // # of source nodes
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix Q = NULL ;           // the current frontiers, ns-by-n
+    GrB_Vector w = NULL ;           // to compute work remaining
+    GrB_Matrix Pi = NULL ;          // parent matrix
+    GrB_Matrix V = NULL ;           // level matrix
+    GrB_Index *I = NULL ;
+    int64_t *X = NULL ;
+
+    bool compute_level  = (level != NULL) ;
+    bool compute_parent = (parent != NULL) ;
+    if (compute_level ) (*level ) = NULL ;
+    if (compute_parent) (*parent) = NULL ;
+    LG_ASSERT_MSG (compute_level || compute_parent, GrB_NULL_POINTER,
+        "either level or parent must be non-NULL") ;
+    LG_ASSERT (sources != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (ns > 0, GrB_INVALID_VALUE, "ns must be > 0") ;
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // get the problem size and cached properties
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix A = G->A ;
+
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    for (int64_t i = 0 ; i < ns ; i++)
+    {
+        LG_ASSERT_MSG (sources [i] < n, GrB_INVALID_INDEX,
+            "invalid source node") ;
+    }
+
+    GrB_Matrix AT = NULL ;
+    GrB_Vector Degree = G->out_degree ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE))
+    {
+        // AT and A have the same structure and can be used in both directions
+        AT = G->A ;
+    }
+    else
+    {
+        // AT = A' is different from A.  If G->AT is NULL, then a push-only
+        // method is used.
+        AT = G->AT ;
+    }
+
+    // direction-optimization requires G->AT (if G is directed) and
+    // G->out_degree (for both undirected and directed cases)
+    bool push_pull = (Degree != NULL && AT != NULL) ;
+
+    // determine the semiring type
+    GrB_Type int_type = (n > INT32_MAX) ? GrB_INT64 : GrB_INT32 ;
+    GrB_Semiring semiring ;
+
+    //--------------------------------------------------------------------------
+    // construct the initial frontiers: Q (i, sources [i]) = sources [i]
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, ns, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &X, ns, sizeof (int64_t), msg)) ;
+    for (int64_t i = 0 ; i < ns ; i++)
+    {
+        I [i] = i ;
+        X [i] = sources [i] ;
+    }
+
+    if (compute_parent)
+    {
+        #if LAGRAPH_SUITESPARSE
+        // use the ANY_SECONDI_INT* semiring: either 32 or 64-bit depending on
+        // the # of nodes in the graph.  Q(i,j) becomes the index k of the
+        // node in the frontier Q(i,:) that first discovered node j.
+        semiring = (n > INT32_MAX) ?
+            GxB_ANY_SECONDI_INT64 : GxB_ANY_SECONDI_INT32 ;
+        #else
+        // Q(i,k) is set to k before each step, with GrB_COLINDEX, and then
+        // the MIN_FIRST semiring selects the smallest such k.
+        semiring = (n > INT32_MAX) ?
+            GrB_MIN_FIRST_SEMIRING_INT64 : GrB_MIN_FIRST_SEMIRING_INT32 ;
+        #endif
+
+        // create the parent matrix.  Pi(i,j) is the parent id of node j in
+        // the ith BFS, and Pi (i,sources [i]) = sources [i] denotes the root
+        GRB_TRY (GrB_Matrix_new (&Pi, int_type, ns, n)) ;
+        GRB_TRY (GrB_Matrix_build_INT64 (Pi, I, sources, X, ns, NULL)) ;
+
+        // create a sparse integer matrix Q, with Q(i,sources [i]) = sources [i]
+        GRB_TRY (GrB_Matrix_new (&Q, int_type, ns, n)) ;
+        GRB_TRY (GrB_Matrix_build_INT64 (Q, I, sources, X, ns, NULL)) ;
+    }
+    else
+    {
+        // only the level is needed, use the LAGraph_any_one_bool semiring
+        semiring = LAGraph_any_one_bool ;
+
+        // create a sparse boolean matrix Q, with Q(i,sources [i]) = true
+        for (int64_t i = 0 ; i < ns ; i++) X [i] = 1 ;
+        GRB_TRY (GrB_Matrix_new (&Q, GrB_BOOL, ns, n)) ;
+        GRB_TRY (GrB_Matrix_build_INT64 (Q, I, sources, X, ns, NULL)) ;
+    }
+
+    if (compute_level)
+    {
+        // create the level matrix. V(i,j) is the level of node j in the ith
+        // BFS, and V (i,sources [i]) = 0 denotes the source node
+        for (int64_t i = 0 ; i < ns ; i++) X [i] = 0 ;
+        GRB_TRY (GrB_Matrix_new (&V, int_type, ns, n)) ;
+        GRB_TRY (GrB_Matrix_build_INT64 (V, I, sources, X, ns, NULL)) ;
+    }
+
+    LAGraph_Free ((void **) &I, NULL) ;
+    LAGraph_Free ((void **) &X, NULL) ;
+
+    // workspace for computing work remaining
+    GRB_TRY (GrB_Vector_new (&w, GrB_INT64, ns)) ;
+
+    // the heuristics of LG_BreadthFirstSearch_SSGrB, applied to the total
+    // size of all the frontiers and all the edges in the graph, ns times,
+    // with the thresholds calibrated for G (or the defaults, if not known)
+    GrB_Index nq = ns ;         // number of nodes in the current level
+    double alpha = (G->bfs_alpha > 0) ? G->bfs_alpha : LG_BFS_ALPHA ;
+    double beta1 = (G->bfs_beta1 > 0) ? G->bfs_beta1 : LG_BFS_BETA1 ;
+    double beta2 = (G->bfs_beta2 > 0) ? G->bfs_beta2 : LG_BFS_BETA2 ;
+    double nodes = ((double) n) * ((double) ns) ;
+    int64_t n_over_beta1 = (int64_t) (nodes / beta1) ;
+    int64_t n_over_beta2 = (int64_t) (nodes / beta2) ;
+
+    //--------------------------------------------------------------------------
+    // BFS traversal and label the nodes
+    //--------------------------------------------------------------------------
+
+    bool do_push = true ;       // start with push
+    GrB_Index last_nq = 0 ;
+    double edges_unexplored = ((double) nvals) * ((double) ns) ;
+    bool any_pull = false ;     // true if any pull phase has been done
+
+    // {!mask} is the set of unvisited nodes in each BFS
+    GrB_Matrix mask = (compute_parent) ? Pi : V ;
+
+    for (int64_t k = 1 ; k <= (int64_t) n ; k++)
+    {
+
+        //----------------------------------------------------------------------
+        // select push vs pull, for all the searches in the batch
+        //----------------------------------------------------------------------
+
+        if (push_pull)
+        {
+            if (do_push)
+            {
+                // check for switch from push to pull
+                bool growing = nq > last_nq ;
+                bool switch_to_pull = false ;
+                if (edges_unexplored < nodes)
+                {
+                    // very little of the graph is left; disable the pull
+                    push_pull = false ;
+                }
+                else if (any_pull)
+                {
+                    // see LG_BreadthFirstSearch_SSGrB
+                    switch_to_pull = (growing && (int64_t) nq > n_over_beta1) ;
+                }
+                else
+                {
+                    // w(i) = # of edges incident on the frontier Q(i,:)
+                    GRB_TRY (GrB_mxv (w, NULL, NULL, LAGraph_plus_second_int64,
+                        Q, Degree, NULL)) ;
+                    // edges_in_frontier = sum (w)
+                    int64_t edges_in_frontier = 0 ;
+                    GRB_TRY (GrB_reduce (&edges_in_frontier, NULL,
+                        GrB_PLUS_MONOID_INT64, w, NULL)) ;
+                    edges_unexplored -= edges_in_frontier ;
+                    switch_to_pull = growing &&
+                        (edges_in_frontier > (edges_unexplored / alpha)) ;
+                }
+                if (switch_to_pull)
+                {
+                    // switch from push to pull
+                    do_push = false ;
+                }
+            }
+            else
+            {
+                // check for switch from pull to push
+                bool shrinking = nq < last_nq ;
+                if (shrinking && ((int64_t) nq <= n_over_beta2))
+                {
+                    // switch from pull to push
+                    do_push = true ;
+                }
+            }
+            any_pull = any_pull || (!do_push) ;
+        }
+
+        //----------------------------------------------------------------------
+        // Q = kth level of all the searches
+        //----------------------------------------------------------------------
+
+        #if LAGRAPH_SUITESPARSE
+        int sparsity = do_push ? GxB_SPARSE : GxB_BITMAP ;
+        GRB_TRY (GxB_set (Q, GxB_SPARSITY_CONTROL, sparsity)) ;
+        #else
+        if (compute_parent)
+        {
+            // Q(i,k) = k for each node k in the ith frontier
+            GrB_IndexUnaryOp colindex = (n > INT32_MAX) ?
+                GrB_COLINDEX_INT64 : GrB_COLINDEX_INT32 ;
+            GRB_TRY (GrB_apply (Q, NULL, NULL, colindex, Q, 0, NULL)) ;
+        }
+        #endif
+
+        // mask is Pi if computing parent, V if computing just level
+        if (do_push)
+        {
+            // push (saxpy-based mxm):  Q{!mask} = Q*A
+            GRB_TRY (GrB_mxm (Q, mask, NULL, semiring, Q, A, GrB_DESC_RSC)) ;
+        }
+        else
+        {
+            // pull (dot-product-based mxm):  Q{!mask} = Q*AT'
+            GRB_TRY (GrB_mxm (Q, mask, NULL, semiring, Q, AT,
+                GrB_DESC_RSCT1)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // done if Q is empty
+        //----------------------------------------------------------------------
+
+        last_nq = nq ;
+        GRB_TRY (GrB_Matrix_nvals (&nq, Q)) ;
+        if (nq == 0)
+        {
+            break ;
+        }
+
+        //----------------------------------------------------------------------
+        // assign parents/levels
+        //----------------------------------------------------------------------
+
+        if (compute_parent)
+        {
+            // Q(i,j) currently contains the parent id of node j in ith tree.
+            // Pi{Q} = Q
+            GRB_TRY (GrB_assign (Pi, Q, NULL, Q, GrB_ALL, ns, GrB_ALL, n,
+                GrB_DESC_S)) ;
+        }
+        if (compute_level)
+        {
+            // V{Q} = k, the kth level of the BFS
+            GRB_TRY (GrB_assign (V, Q, NULL, k, GrB_ALL, ns, GrB_ALL, n,
+                GrB_DESC_S)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    if (compute_parent) (*parent) = Pi ;
+    if (compute_level ) (*level ) = V ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,275 @@
+//------------------------------------------------------------------------------
+// LAGraph_MultiSourceSSSP: shortest paths from many sources at once
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_MultiSourceSSSP computes ns single-source shortest path problems at
+// the same time, one from each node in the sources array, with the same
+// delta-stepping method as LAGr_SingleSourceShortestPath.  G->A is split into
+// its light (AL) and heavy (AH) edges just once, for all the sources.  The
+// tentative path lengths of all the searches are held as the rows of a single
+// ns-by-n matrix T, and each relaxation is done for all the sources with a
+// single min_plus GrB_mxm.  The buckets are shared: bucket k holds the entries
+// of T in the range k*Delta to (k+1)*Delta, for all the sources, and the
+// method stops when no source has any work left.  The result is returned as
+// a dense ns-by-n matrix, where row i holds the path lengths from sources [i]:
+
+//      path_length (i,j) = length of the shortest path from sources [i] to j
+
+// If node j is not reachable from sources [i], path_length (i,j) is INFINITY
+// for GrB_FP32 and GrB_FP64, or the largest integer of its type for GrB_INT32,
+// GrB_INT64, GrB_UINT32, or GrB_UINT64.  G->A must have one of these types.
+// The sources may contain duplicates.
+
+// This is an Advanced algorithm (G->emin is required for best performance).
+// As with LAGr_SingleSourceShortestPath, this method gets stuck in an infinite
+// loop when there are negative-weight cycles in the graph.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&AL) ;                \
+    GrB_free (&AH) ;                \
+    GrB_free (&lBound) ;            \
+    GrB_free (&uBound) ;            \
+    GrB_free (&infinity) ;          \
+    GrB_free (&Tmasked) ;           \
+    GrB_free (&Treq) ;              \
+    GrB_free (&Tless) ;             \
+    GrB_free (&S) ;                 \
+    GrB_free (&Reach) ;             \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (&T) ;                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_MultiSourceSSSP
+(
+    // output:
+    GrB_Matrix *path_length,    // path_length (i,j) is the length of the
+                                // shortest path from sources [i] to node j
+    // inputs:
+    const LAGraph_Graph G,      // input graph, not modified
+    const GrB_Index *sources,   // source nodes
+    int64_t ns,                 // # of source nodes
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Scalar lBound = NULL ;      // the thresholds for GrB_select
+    GrB_Scalar uBound = NULL ;
+    GrB_Scalar infinity = NULL ;    // path length of unreachable nodes
+    GrB_Matrix AL = NULL ;          // the light weight edges
+    GrB_Matrix AH = NULL ;          // the heavy weight edges
+    GrB_Matrix T = NULL ;           // tentative shortest path lengths
+    GrB_Matrix Tmasked = NULL ;     // the entries of T in the current bucket
+    GrB_Matrix Treq = NULL ;        // requested path lengths
+    GrB_Matrix Tless = NULL ;       // Tless (i,j) is true if Treq (i,j) is
+                                    // less than T (i,j)
+    GrB_Matrix S = NULL ;           // nodes in the current bucket
+    GrB_Matrix Reach = NULL ;       // nodes reached but not yet settled
+
+    LG_ASSERT (path_length != NULL, GrB_NULL_POINTER) ;
+    (*path_length) = NULL ;
+    LG_ASSERT (sources != NULL && Delta != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (ns > 0, GrB_INVALID_VALUE, "ns must be > 0") ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Index nvals ;
+    GRB_TRY (GrB_Scalar_nvals (&nvals, Delta)) ;
+    LG_ASSERT_MSG (nvals == 1, GrB_EMPTY_OBJECT, "Delta is missing") ;
+    double delta = 0 ;
+    GRB_TRY (GrB_Scalar_extractElement_FP64 (&delta, Delta)) ;
+    LG_ASSERT_MSG (delta > 0, GrB_INVALID_VALUE, "Delta must be > 0") ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    for (int64_t i = 0 ; i < ns ; i++)
+    {
+        LG_ASSERT_MSG (sources [i] < n, GrB_INVALID_INDEX,
+            "invalid source node") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // select the operators for the type of G->A
+    //--------------------------------------------------------------------------
+
+    LG_SSSP_Operators ops ;
+    LG_TRY (LG_SSSP_GetOperators (&ops, &infinity, G, msg)) ;
+    GrB_Type etype = ops.type ;
+    GrB_IndexUnaryOp le = ops.le, ge = ops.ge, lt = ops.lt, gt = ops.gt ;
+    GrB_BinaryOp less_than = ops.less_than ;
+    GrB_Semiring min_plus = ops.min_plus ;
+    bool negative_edge_weights = ops.negative_edge_weights ;
+
+    GRB_TRY (GrB_Scalar_new (&lBound, etype)) ;
+    GRB_TRY (GrB_Scalar_new (&uBound, etype)) ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (&T, etype, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&Tmasked, etype, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&Treq, etype, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&Tless, GrB_BOOL, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&S, GrB_BOOL, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&Reach, GrB_BOOL, ns, n)) ;
+
+    // T (:,:) = infinity
+    GRB_TRY (GrB_assign (T, NULL, NULL, infinity, GrB_ALL, ns, GrB_ALL, n,
+        NULL)) ;
+
+    // T (i, sources [i]) = 0, and Reach and S likewise
+    for (int64_t i = 0 ; i < ns ; i++)
+    {
+        GRB_TRY (GrB_Matrix_setElement (T, 0, i, sources [i])) ;
+        GRB_TRY (GrB_Matrix_setElement (Reach, true, i, sources [i])) ;
+        GRB_TRY (GrB_Matrix_setElement (S, true, i, sources [i])) ;
+    }
+
+    // AL = A .* (A <= Delta), and AH = A .* (A > Delta), once for all sources
+    GRB_TRY (GrB_Matrix_new (&AL, etype, n, n)) ;
+    GRB_TRY (GrB_select (AL, NULL, NULL, le, A, Delta, NULL)) ;
+    GRB_TRY (GrB_wait (AL, GrB_MATERIALIZE)) ;
+    GRB_TRY (GrB_Matrix_new (&AH, etype, n, n)) ;
+    GRB_TRY (GrB_select (AH, NULL, NULL, gt, A, Delta, NULL)) ;
+    GRB_TRY (GrB_wait (AH, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // while (T >= step*Delta) not empty, for any source
+    //--------------------------------------------------------------------------
+
+    for (int64_t step = 0 ; ; step++)
+    {
+
+        //----------------------------------------------------------------------
+        // Tmasked = all entries in T<Reach> that are less than (step+1)*Delta
+        //----------------------------------------------------------------------
+
+        GRB_TRY (GrB_Scalar_setElement_FP64 (uBound, (step+1) * delta)) ;
+        GRB_TRY (GrB_Scalar_setElement_FP64 (lBound, step * delta)) ;
+        GRB_TRY (GrB_Matrix_clear (Tmasked)) ;
+        GRB_TRY (GrB_assign (Tmasked, Reach, NULL, T, GrB_ALL, ns, GrB_ALL, n,
+            GrB_DESC_S)) ;
+        GRB_TRY (GrB_select (Tmasked, NULL, NULL, lt, Tmasked, uBound, NULL)) ;
+        GrB_Index tmasked_nvals ;
+        GRB_TRY (GrB_Matrix_nvals (&tmasked_nvals, Tmasked)) ;
+
+        //----------------------------------------------------------------------
+        // relax the light edges while the current bucket is not empty
+        //----------------------------------------------------------------------
+
+        while (tmasked_nvals > 0)
+        {
+            // Treq = Tmasked min.+ AL
+            GRB_TRY (GrB_mxm (Treq, NULL, NULL, min_plus, Tmasked, AL, NULL)) ;
+
+            // S<struct(Tmasked)> = true
+            GRB_TRY (GrB_assign (S, Tmasked, NULL, (bool) true, GrB_ALL, ns,
+                GrB_ALL, n, GrB_DESC_S)) ;
+
+            GrB_Index treq_nvals ;
+            GRB_TRY (GrB_Matrix_nvals (&treq_nvals, Treq)) ;
+            if (treq_nvals == 0) break ;
+
+            // Tless = (Treq .< T), with its false entries removed
+            GRB_TRY (GrB_eWiseMult (Tless, NULL, NULL, less_than, Treq, T,
+                NULL)) ;
+            GRB_TRY (GrB_select (Tless, NULL, NULL, GrB_VALUEEQ_BOOL, Tless,
+                true, NULL)) ;
+            GrB_Index tless_nvals ;
+            GRB_TRY (GrB_Matrix_nvals (&tless_nvals, Tless)) ;
+            if (tless_nvals == 0) break ;
+
+            // Reach<struct(Tless)> = true
+            GRB_TRY (GrB_assign (Reach, Tless, NULL, (bool) true, GrB_ALL, ns,
+                GrB_ALL, n, GrB_DESC_S)) ;
+
+            // Tmasked<struct(Tless)> = select (Treq < (step+1)*Delta)
+            GRB_TRY (GrB_Matrix_clear (Tmasked)) ;
+            GRB_TRY (GrB_select (Tmasked, Tless, NULL, lt, Treq, uBound,
+                GrB_DESC_S)) ;
+            if (negative_edge_weights)
+            {
+                // Tmasked = select (Tmasked >= step*Delta)
+                GRB_TRY (GrB_select (Tmasked, NULL, NULL, ge, Tmasked, lBound,
+                    NULL)) ;
+            }
+
+            // T<struct(Tless)> = Treq
+            GRB_TRY (GrB_assign (T, Tless, NULL, Treq, GrB_ALL, ns, GrB_ALL, n,
+                GrB_DESC_S)) ;
+            GRB_TRY (GrB_Matrix_nvals (&tmasked_nvals, Tmasked)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // relax the heavy edges of all nodes settled in this bucket
+        //----------------------------------------------------------------------
+
+        // Tmasked<S> = T
+        GRB_TRY (GrB_Matrix_clear (Tmasked)) ;
+        GRB_TRY (GrB_assign (Tmasked, S, NULL, T, GrB_ALL, ns, GrB_ALL, n,
+            GrB_DESC_S)) ;
+
+        // Treq = Tmasked min.+ AH
+        GRB_TRY (GrB_mxm (Treq, NULL, NULL, min_plus, Tmasked, AH, NULL)) ;
+
+        // T<Tless> = Treq, where Tless = (Treq .< T)
+        GRB_TRY (GrB_eWiseMult (Tless, NULL, NULL, less_than, Treq, T, NULL)) ;
+        GRB_TRY (GrB_assign (T, Tless, NULL, Treq, GrB_ALL, ns, GrB_ALL, n,
+            NULL)) ;
+
+        //----------------------------------------------------------------------
+        // find out how many are left to be computed
+        //----------------------------------------------------------------------
+
+        // Reach<Tless> = true
+        GRB_TRY (GrB_assign (Reach, Tless, NULL, (bool) true, GrB_ALL, ns,
+            GrB_ALL, n, NULL)) ;
+
+        // remove the nodes settled in this bucket: Reach<struct(S)> = empty
+        GRB_TRY (GrB_Matrix_clear (Tless)) ;
+        GRB_TRY (GrB_assign (Reach, S, NULL, Tless, GrB_ALL, ns, GrB_ALL, n,
+            GrB_DESC_S)) ;
+        GrB_Index nreach ;
+        GRB_TRY (GrB_Matrix_nvals (&nreach, Reach)) ;
+        if (nreach == 0) break ;
+
+        GRB_TRY (GrB_Matrix_clear (S)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*path_length) = T ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,320 @@
+//------------------------------------------------------------------------------
+// LAGraph_PageRankIncremental: warm-started PageRank, with a push mode
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_PageRankIncremental computes the same PageRank as LAGr_PageRank, but
+// it can start from a prior centrality vector r0 instead of r = 1/n.  This is
+// useful when r0 is the PageRank of the graph before a small number of edges
+// were added or removed, since r0 is then already close to the new result.
+// r0 may have any real type, and any entries not present in r0 (new nodes,
+// say) start at zero.  r0 must have size n, and it is scaled so that it sums to
+// one.  If r0 is NULL, the iterations start at r = 1/n, as in LAGr_PageRank.
+
+// Two methods are available.  If push is false, the power iterations of
+// LAGr_PageRank are used, starting at r0.  Each iteration touches all edges of
+// the graph, and the method stops when the 1-norm of the change in r is at most
+// tol.
+
+// If push is true, the residual res = teleport + damping*A'*(r./d_out) - r of
+// the current r is propagated instead.  The residual is held as a sparse
+// vector, with entries only for nodes with a nonzero residual; entries of the
+// initial residual no larger than tol/n in magnitude are dropped.  Each round
+// takes the set of nodes whose residual exceeds tol/n in magnitude, moves their
+// residual into r, deletes it from res, and pushes it to their out-neighbors
+// with w'*A, where w is sparse (a push step, as done in
+// LG_BreadthFirstSearch_SSGrB).  Only the out-edges of these active nodes are
+// touched, so a warm start after a small change to the graph converges with a
+// small fraction of the work of the power method.  The residual of the sinks
+// is spread over all nodes, which is held as a single scalar and flushed to
+// all nodes only when no other node is active; this is a full round, so graphs
+// with many sinks see less benefit.  The method stops when no node has a
+// residual larger than tol/n, and iters is the number of push rounds.
+
+// The residual may be negative (edges can be deleted), so the result can
+// differ from LAGr_PageRank by about tol / (1-damping) in the 1-norm for the
+// power method, and about 2*tol / (1-damping) for the push method (from the
+// residual left at the end, and the residual dropped at the start).
+
+// If nedges is not NULL, it is returned as the number of edges traversed:
+// iters*nvals(A) for the power method, and nvals(A) for the first step plus
+// the out-degrees of the active nodes of each round for the push method.
+
+// This is an Advanced algorithm (G->AT and G->out_degree are required), with
+// the same requirements as LAGr_PageRank.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&d) ;                 \
+    GrB_free (&t) ;                 \
+    GrB_free (&w) ;                 \
+    GrB_free (&q) ;                 \
+    GrB_free (&res) ;               \
+    GrB_free (&qdeg) ;              \
+    GrB_free (&sink) ;              \
+    GrB_free (&rsink) ;             \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (&r) ;                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_PageRankIncremental
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations (or push rounds) taken
+    GrB_Index *nedges,      // # of edges traversed (optional; may be NULL)
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Vector r0,    // initial centrality (NULL: start at 1/n)
+    bool push,              // if true, use residual propagation
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector r = NULL, d = NULL, t = NULL, w = NULL, q = NULL, res = NULL ;
+    GrB_Vector qdeg = NULL, sink = NULL, rsink = NULL ;
+    LG_ASSERT (centrality != NULL && iters != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    if (nedges != NULL) (*nedges) = 0 ;
+    // get AT, the sinks, and d = max (d_out / damping, 1 / damping)
+    GrB_Matrix AT ;
+    GrB_Index nsinks ;
+    LG_TRY (LG_PageRank_Setup (&AT, &d, &sink, &nsinks, G, GrB_FP32, damping,
+        msg)) ;
+    GrB_Vector d_out = G->out_degree ;
+
+    GrB_Index n, nvals_A ;
+    GRB_TRY (GrB_Matrix_nrows (&n, AT)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals_A, G->A)) ;
+
+    //--------------------------------------------------------------------------
+    // r = r0 / sum (r0), or r = 1/n if r0 is not provided
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Vector_new (&r, GrB_FP32, n)) ;
+    if (r0 == NULL)
+    {
+        GRB_TRY (GrB_assign (r, NULL, NULL, (float) (1.0 / n), GrB_ALL, n,
+            NULL)) ;
+    }
+    else
+    {
+        GrB_Index r0size ;
+        GRB_TRY (GrB_Vector_size (&r0size, r0)) ;
+        LG_ASSERT_MSG (r0size == n, GrB_DIMENSION_MISMATCH,
+            "r0 must have size n") ;
+        // r = 0 ; r<struct(r0)> = r0, typecasting to float
+        GRB_TRY (GrB_assign (r, NULL, NULL, (float) 0, GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_assign (r, r0, NULL, r0, GrB_ALL, n, GrB_DESC_S)) ;
+        float rsum = 0 ;
+        GRB_TRY (GrB_reduce (&rsum, NULL, GrB_PLUS_MONOID_FP32, r, NULL)) ;
+        LG_ASSERT_MSG (rsum > 0, GrB_INVALID_VALUE,
+            "r0 must have a positive sum") ;
+        GRB_TRY (GrB_apply (r, NULL, NULL, GrB_DIV_FP32, r, rsum, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    const float damping_over_n = damping / n ;
+    const float scaled_damping = (1 - damping) / n ;
+    float rdiff = 1 ;       // first iteration is always done
+
+    GRB_TRY (GrB_Vector_new (&t, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Vector_new (&w, GrB_FP32, n)) ;
+
+    if (nsinks > 0)
+    {
+        GRB_TRY (GrB_Vector_new (&rsink, GrB_FP32, n)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // t = teleport + A'*(r./d), one step of the power method
+    //--------------------------------------------------------------------------
+
+    // This is the first iteration of the power method, and it also defines the
+    // initial residual res = t - r for the push method.
+
+    float teleport = scaled_damping ;
+    if (nsinks > 0)
+    {
+        // teleport += (damping/n) * sum (r (sink))
+        float sum_rsink = 0 ;
+        GRB_TRY (GrB_Vector_clear (rsink)) ;
+        GRB_TRY (GrB_assign (rsink, sink, NULL, r, GrB_ALL, n, GrB_DESC_S)) ;
+        GRB_TRY (GrB_reduce (&sum_rsink, NULL, GrB_PLUS_MONOID_FP32, rsink,
+            NULL)) ;
+        teleport += damping_over_n * sum_rsink ;
+    }
+    GRB_TRY (GrB_eWiseMult (w, NULL, NULL, GrB_DIV_FP32, r, d, NULL)) ;
+    GRB_TRY (GrB_assign (t, NULL, NULL, teleport, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_mxv (t, NULL, GrB_PLUS_FP32, LAGraph_plus_second_fp32, AT, w,
+        NULL)) ;
+
+    if (!push)
+    {
+
+        //----------------------------------------------------------------------
+        // power iterations, starting at r
+        //----------------------------------------------------------------------
+
+        for ((*iters) = 1 ; ; (*iters)++)
+        {
+            // swap t and r ; now t is the old score
+            GrB_Vector temp = t ; t = r ; r = temp ;
+            // t = abs (t - r) ; rdiff = sum (t)
+            GRB_TRY (GrB_assign (t, NULL, GrB_MINUS_FP32, r, GrB_ALL, n,
+                NULL)) ;
+            GRB_TRY (GrB_apply (t, NULL, NULL, GrB_ABS_FP32, t, NULL)) ;
+            GRB_TRY (GrB_reduce (&rdiff, NULL, GrB_PLUS_MONOID_FP32, t, NULL)) ;
+            if (rdiff <= tol) break ;
+            // check for convergence
+            LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+                "pagerank failed to converge in %d iterations", itermax) ;
+            // determine teleport and handle any sinks
+            teleport = scaled_damping ;
+            if (nsinks > 0)
+            {
+                float sum_rsink = 0 ;
+                GRB_TRY (GrB_Vector_clear (rsink)) ;
+                GRB_TRY (GrB_assign (rsink, sink, NULL, r, GrB_ALL, n,
+                    GrB_DESC_S)) ;
+                GRB_TRY (GrB_reduce (&sum_rsink, NULL, GrB_PLUS_MONOID_FP32,
+                    rsink, NULL)) ;
+                teleport += damping_over_n * sum_rsink ;
+            }
+            // t = teleport + A'*(r./d)
+            GRB_TRY (GrB_eWiseMult (w, NULL, NULL, GrB_DIV_FP32, r, d, NULL)) ;
+            GRB_TRY (GrB_assign (t, NULL, NULL, teleport, GrB_ALL, n, NULL)) ;
+            GRB_TRY (GrB_mxv (t, NULL, GrB_PLUS_FP32, LAGraph_plus_second_fp32,
+                AT, w, NULL)) ;
+        }
+        if (nedges != NULL) (*nedges) = (*iters) * nvals_A ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // residual propagation, starting at r
+        //----------------------------------------------------------------------
+
+        // res = t - r, the residual of the starting point
+        GRB_TRY (GrB_Vector_new (&res, GrB_FP32, n)) ;
+        GRB_TRY (GrB_Vector_new (&q, GrB_FP32, n)) ;
+        GRB_TRY (GrB_eWiseAdd (q, NULL, NULL, GrB_MINUS_FP32, t, r, NULL)) ;
+        GrB_free (&t) ;
+        const float eps = tol / n ;
+        // res = q (abs (q) > eps), dropping the tiny entries so res is sparse
+        GRB_TRY (GrB_select (res, NULL, NULL, GrB_VALUEGT_FP32, q, eps,
+            NULL)) ;
+        GRB_TRY (GrB_select (res, NULL, GrB_PLUS_FP32, GrB_VALUELT_FP32, q,
+            -eps, NULL)) ;
+        if (nedges != NULL)
+        {
+            GRB_TRY (GrB_Vector_new (&qdeg, GrB_INT64, n)) ;
+            (*nedges) = nvals_A ;
+        }
+
+        // uniform residual of all nodes, from the sinks, not yet in res
+        float ures = 0 ;
+
+        for ((*iters) = 0 ; ; )
+        {
+            // q = res (abs (res) > eps), the residual of the active nodes
+            GRB_TRY (GrB_select (q, NULL, NULL, GrB_VALUEGT_FP32, res, eps,
+                NULL)) ;
+            GRB_TRY (GrB_select (q, NULL, GrB_PLUS_FP32, GrB_VALUELT_FP32, res,
+                -eps, NULL)) ;
+            GrB_Index nactive ;
+            GRB_TRY (GrB_Vector_nvals (&nactive, q)) ;
+            if (nactive == 0)
+            {
+                // no more work, unless the sinks have pushed enough residual
+                if (fabsf (ures) <= eps) break ;
+                // res += ures, to all nodes
+                GRB_TRY (GrB_assign (res, NULL, GrB_PLUS_FP32, ures, GrB_ALL,
+                    n, NULL)) ;
+                ures = 0 ;
+                continue ;
+            }
+
+            // check for convergence
+            LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+                "pagerank failed to converge in %d rounds", itermax) ;
+            (*iters)++ ;
+
+            // move the residual of the active nodes into r, and delete it
+            // from res: res<!struct(q),replace> = res
+            GRB_TRY (GrB_assign (r, NULL, GrB_PLUS_FP32, q, GrB_ALL, n, NULL)) ;
+            GRB_TRY (GrB_assign (res, q, NULL, res, GrB_ALL, n,
+                GrB_DESC_RSC)) ;
+
+            if (nsinks > 0)
+            {
+                // ures += (damping/n) * sum (q (sink))
+                float sum_qsink = 0 ;
+                GRB_TRY (GrB_eWiseMult (rsink, NULL, NULL, GrB_FIRST_FP32, q,
+                    sink, NULL)) ;
+                GRB_TRY (GrB_reduce (&sum_qsink, NULL, GrB_PLUS_MONOID_FP32,
+                    rsink, NULL)) ;
+                ures += damping_over_n * sum_qsink ;
+            }
+
+            if (nedges != NULL)
+            {
+                // nedges += sum (d_out (active))
+                int64_t nq = 0 ;
+                GRB_TRY (GrB_eWiseMult (qdeg, NULL, NULL, GrB_FIRST_INT64,
+                    d_out, q, NULL)) ;
+                GRB_TRY (GrB_reduce (&nq, NULL, GrB_PLUS_MONOID_INT64, qdeg,
+                    NULL)) ;
+                (*nedges) += nq ;
+            }
+
+            // res += (q./d)'*A, a push step: w is sparse, so only the
+            // out-edges of the active nodes are touched
+            GRB_TRY (GrB_eWiseMult (w, NULL, NULL, GrB_DIV_FP32, q, d, NULL)) ;
+            GRB_TRY (GrB_vxm (res, NULL, GrB_PLUS_FP32,
+                LAGraph_plus_first_fp32, w, G->A, NULL)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*centrality) = r ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,370 @@
+//------------------------------------------------------------------------------
+// LAGraph_PageRankSolver: PageRank with a choice of iterative solver
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_PageRankSolver computes the same PageRank as LAGr_PageRank, with one
+// of three solvers.  Each solver makes one full pass over the entries of G->AT
+// per iteration, and iters is the number of these passes.
+
+// LAGraph_PageRank_Jacobi: the power method of LAGr_PageRank.  The new r is
+//      computed entirely from the old r.
+
+// LAGraph_PageRank_GaussSeidel: block Gauss-Seidel.  The nodes are split into
+//      LG_PAGERANK_NBLOCKS contiguous blocks, and the rows of G->AT for each
+//      block are extracted once.  In each sweep, each block of r is updated
+//      in turn with the newest values of r for all prior blocks, which
+//      typically takes fewer sweeps than the power method on graphs with a
+//      large diameter.  The rank of the sinks is updated once per sweep.
+
+// LAGraph_PageRank_Extrapolated: the power method, accelerated with quadratic
+//      extrapolation (Kamvar, Haveliwala, Manning, and Golub, "Extrapolation
+//      methods for accelerating PageRank computations", WWW 2003).  Every
+//      LG_PAGERANK_PERIOD iterations, the last four iterates are combined to
+//      cancel the components of the error along the second and third
+//      eigenvectors of the PageRank matrix, and the result is scaled to sum to
+//      one.  This costs a few vector operations, but no extra passes over
+//      G->AT.
+
+// All methods use FP32, and stop when the 1-norm of the change in r in one
+// iteration is at most tol.
+
+// This is an Advanced algorithm (G->AT and G->out_degree are required), with
+// the same requirements as LAGr_PageRank.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// number of blocks for Gauss-Seidel
+#define LG_PAGERANK_NBLOCKS 16
+
+// number of iterations between quadratic extrapolations
+#define LG_PAGERANK_PERIOD 10
+
+//------------------------------------------------------------------------------
+// LG_dot: s = x'*y, computed in double precision
+//------------------------------------------------------------------------------
+
+static int LG_dot
+(
+    double *s,          // result
+    GrB_Vector x,       // input vectors
+    GrB_Vector y,
+    GrB_Vector z,       // workspace, of size n
+    char *msg
+)
+{
+    GRB_TRY (GrB_eWiseMult (z, NULL, NULL, GrB_TIMES_FP64, x, y, NULL)) ;
+    (*s) = 0 ;
+    GRB_TRY (GrB_reduce (s, NULL, GrB_PLUS_MONOID_FP64, z, NULL)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_PageRankSolver
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#undef  LG_FREE_ALL
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&d) ;                                 \
+    GrB_free (&t) ;                                 \
+    GrB_free (&w) ;                                 \
+    GrB_free (&sink) ;                              \
+    GrB_free (&rsink) ;                             \
+    GrB_free (&x0) ;                                \
+    GrB_free (&x1) ;                                \
+    GrB_free (&x2) ;                                \
+    GrB_free (&y) ;                                 \
+    for (int b = 0 ; b < LG_PAGERANK_NBLOCKS ; b++) \
+    {                                               \
+        if (ATb != NULL) GrB_free (&(ATb [b])) ;    \
+        if (db  != NULL) GrB_free (&(db  [b])) ;    \
+        if (tb  != NULL) GrB_free (&(tb  [b])) ;    \
+    }                                               \
+    LAGraph_Free ((void **) &ATb, NULL) ;           \
+    LAGraph_Free ((void **) &db, NULL) ;            \
+    LAGraph_Free ((void **) &tb, NULL) ;            \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (&r) ;                                 \
+}
+
+int LAGraph_PageRankSolver
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    LAGraph_PageRank_Method method,     // Jacobi, Gauss-Seidel, or extrapolated
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector r = NULL, d = NULL, t = NULL, w = NULL, sink = NULL ;
+    GrB_Vector rsink = NULL, x0 = NULL, x1 = NULL, x2 = NULL, y = NULL ;
+    GrB_Matrix *ATb = NULL ;
+    GrB_Vector *db = NULL, *tb = NULL ;
+    GrB_Index *I = NULL ;
+    LG_ASSERT (centrality != NULL && iters != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_ASSERT_MSG (method == LAGraph_PageRank_Jacobi ||
+        method == LAGraph_PageRank_GaussSeidel ||
+        method == LAGraph_PageRank_Extrapolated, GrB_INVALID_VALUE,
+        "invalid method") ;
+    // get AT, the sinks, and d = max (d_out / damping, 1 / damping)
+    GrB_Matrix AT ;
+    GrB_Index nsinks ;
+    LG_TRY (LG_PageRank_Setup (&AT, &d, &sink, &nsinks, G, GrB_FP32, damping,
+        msg)) ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, AT)) ;
+
+    const float damping_over_n = damping / n ;
+    const float scaled_damping = (1 - damping) / n ;
+    float rdiff = 1 ;       // first iteration is always done
+
+    // r = 1 / n
+    GRB_TRY (GrB_Vector_new (&t, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Vector_new (&r, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Vector_new (&w, GrB_FP32, n)) ;
+    GRB_TRY (GrB_assign (r, NULL, NULL, (float) (1.0 / n), GrB_ALL, n, NULL)) ;
+
+    if (nsinks > 0)
+    {
+        GRB_TRY (GrB_Vector_new (&rsink, GrB_FP32, n)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // extract the blocks of AT and d for Gauss-Seidel
+    //--------------------------------------------------------------------------
+
+    int nblocks = (int) LAGRAPH_MIN (n, LG_PAGERANK_NBLOCKS) ;
+    if (method == LAGraph_PageRank_GaussSeidel)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &I, n, sizeof (GrB_Index), msg)) ;
+        for (GrB_Index i = 0 ; i < n ; i++)
+        {
+            I [i] = i ;
+        }
+        LG_TRY (LAGraph_Calloc ((void **) &ATb, LG_PAGERANK_NBLOCKS,
+            sizeof (GrB_Matrix), msg)) ;
+        LG_TRY (LAGraph_Calloc ((void **) &db, LG_PAGERANK_NBLOCKS,
+            sizeof (GrB_Vector), msg)) ;
+        LG_TRY (LAGraph_Calloc ((void **) &tb, LG_PAGERANK_NBLOCKS,
+            sizeof (GrB_Vector), msg)) ;
+        for (int b = 0 ; b < nblocks ; b++)
+        {
+            // block b holds nodes lo:hi-1
+            GrB_Index lo = (b * n) / nblocks ;
+            GrB_Index hi = ((b+1) * n) / nblocks ;
+            GrB_Index len = hi - lo ;
+            // ATb {b} = AT (lo:hi-1,:), only the pattern is needed
+            GRB_TRY (GrB_Matrix_new (&(ATb [b]), GrB_BOOL, len, n)) ;
+            GRB_TRY (GrB_extract (ATb [b], NULL, NULL, AT, I + lo, len,
+                GrB_ALL, n, NULL)) ;
+            // db {b} = d (lo:hi-1)
+            GRB_TRY (GrB_Vector_new (&(db [b]), GrB_FP32, len)) ;
+            GRB_TRY (GrB_extract (db [b], NULL, NULL, d, I + lo, len, NULL)) ;
+            GRB_TRY (GrB_Vector_new (&(tb [b]), GrB_FP32, len)) ;
+        }
+        // w = r ./ d
+        GRB_TRY (GrB_eWiseMult (w, NULL, NULL, GrB_DIV_FP32, r, d, NULL)) ;
+    }
+    else if (method == LAGraph_PageRank_Extrapolated)
+    {
+        // x0, x1, x2: the three iterates prior to the current one
+        GRB_TRY (GrB_Vector_new (&x0, GrB_FP32, n)) ;
+        GRB_TRY (GrB_Vector_new (&x1, GrB_FP32, n)) ;
+        GRB_TRY (GrB_Vector_new (&x2, GrB_FP32, n)) ;
+        GRB_TRY (GrB_Vector_new (&y, GrB_FP64, n)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pagerank iterations
+    //--------------------------------------------------------------------------
+
+    for ((*iters) = 0 ; rdiff > tol ; (*iters)++)
+    {
+        // check for convergence
+        LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+            "pagerank failed to converge in %d iterations", itermax) ;
+        // determine teleport and handle any sinks
+        float teleport = scaled_damping ; // teleport = (1 - damping) / n
+        if (nsinks > 0)
+        {
+            // handle the sinks: teleport += (damping/n) * sum (r (sink))
+            // rsink<struct(sink)> = r
+            GRB_TRY (GrB_Vector_clear (rsink)) ;
+            GRB_TRY (GrB_assign (rsink, sink, NULL, r, GrB_ALL, n, GrB_DESC_S));
+            // sum_rsink = sum (rsink)
+            float sum_rsink = 0 ;
+            GRB_TRY (GrB_reduce (&sum_rsink, NULL, GrB_PLUS_MONOID_FP32,
+                rsink, NULL)) ;
+            teleport += damping_over_n * sum_rsink ;
+        }
+
+        if (method == LAGraph_PageRank_GaussSeidel)
+        {
+
+            //------------------------------------------------------------------
+            // one sweep of block Gauss-Seidel
+            //------------------------------------------------------------------
+
+            // t = r, the old score
+            GRB_TRY (GrB_assign (t, NULL, NULL, r, GrB_ALL, n, NULL)) ;
+            for (int b = 0 ; b < nblocks ; b++)
+            {
+                GrB_Index lo = (b * n) / nblocks ;
+                GrB_Index hi = ((b+1) * n) / nblocks ;
+                GrB_Index len = hi - lo ;
+                // tb = teleport + AT (lo:hi-1,:) * w, with the newest w
+                GRB_TRY (GrB_assign (tb [b], NULL, NULL, teleport, GrB_ALL,
+                    len, NULL)) ;
+                GRB_TRY (GrB_mxv (tb [b], NULL, GrB_PLUS_FP32,
+                    LAGraph_plus_second_fp32, ATb [b], w, NULL)) ;
+                // r (lo:hi-1) = tb
+                GRB_TRY (GrB_assign (r, NULL, NULL, tb [b], I + lo, len,
+                    NULL)) ;
+                // w (lo:hi-1) = tb ./ d (lo:hi-1)
+                GRB_TRY (GrB_eWiseMult (tb [b], NULL, NULL, GrB_DIV_FP32,
+                    tb [b], db [b], NULL)) ;
+                GRB_TRY (GrB_assign (w, NULL, NULL, tb [b], I + lo, len,
+                    NULL)) ;
+            }
+
+        }
+        else
+        {
+
+            //------------------------------------------------------------------
+            // one iteration of the power method
+            //------------------------------------------------------------------
+
+            // swap t and r ; now t is the old score
+            GrB_Vector temp = t ; t = r ; r = temp ;
+            // w = t ./ d
+            GRB_TRY (GrB_eWiseMult (w, NULL, NULL, GrB_DIV_FP32, t, d, NULL)) ;
+            // r = teleport
+            GRB_TRY (GrB_assign (r, NULL, NULL, teleport, GrB_ALL, n, NULL)) ;
+            // r += A'*w
+            GRB_TRY (GrB_mxv (r, NULL, GrB_PLUS_FP32, LAGraph_plus_second_fp32,
+                AT, w, NULL)) ;
+        }
+
+        // t = abs (t - r) ; rdiff = sum (t)
+        GRB_TRY (GrB_assign (t, NULL, GrB_MINUS_FP32, r, GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_apply (t, NULL, NULL, GrB_ABS_FP32, t, NULL)) ;
+        GRB_TRY (GrB_reduce (&rdiff, NULL, GrB_PLUS_MONOID_FP32, t, NULL)) ;
+
+        if (method != LAGraph_PageRank_Extrapolated || rdiff <= tol) continue ;
+
+        //----------------------------------------------------------------------
+        // quadratic extrapolation
+        //----------------------------------------------------------------------
+
+        // k = number of iterations done so far, including this one
+        int k = (*iters) + 1 ;
+        int phase = k % LG_PAGERANK_PERIOD ;
+        if (phase >= LG_PAGERANK_PERIOD - 3)
+        {
+            // save x(k-3), x(k-2), or x(k-1) for the next extrapolation
+            GrB_Vector x = (phase == LG_PAGERANK_PERIOD - 3) ? x0 :
+                           (phase == LG_PAGERANK_PERIOD - 2) ? x1 : x2 ;
+            GRB_TRY (GrB_assign (x, NULL, NULL, r, GrB_ALL, n, NULL)) ;
+        }
+        else if (phase == 0)
+        {
+            // r = x(k), and x0, x1, x2 = x(k-3), x(k-2), x(k-1).
+            // x1 = x1 - x0, x2 = x2 - x0, t = r - x0, then solve the 2-by-2
+            // least-squares problem [x1 x2] * [g1 ; g2] = -t.
+            GRB_TRY (GrB_eWiseAdd (x1, NULL, NULL, GrB_MINUS_FP32, x1, x0,
+                NULL)) ;
+            GRB_TRY (GrB_eWiseAdd (x2, NULL, NULL, GrB_MINUS_FP32, x2, x0,
+                NULL)) ;
+            GRB_TRY (GrB_eWiseAdd (t, NULL, NULL, GrB_MINUS_FP32, r, x0,
+                NULL)) ;
+            double aa, ab, bb, ac, bc ;
+            LG_TRY (LG_dot (&aa, x1, x1, y, msg)) ;
+            LG_TRY (LG_dot (&ab, x1, x2, y, msg)) ;
+            LG_TRY (LG_dot (&bb, x2, x2, y, msg)) ;
+            LG_TRY (LG_dot (&ac, x1, t, y, msg)) ;
+            LG_TRY (LG_dot (&bc, x2, t, y, msg)) ;
+            double det = aa * bb - ab * ab ;
+            if (det > 1e-12 * aa * bb)
+            {
+                double g1 = (ab * bc - bb * ac) / det ;
+                double g2 = (ab * ac - aa * bc) / det ;
+                // b0 = g1+g2+1, b1 = g2+1, b2 = 1, and
+                // r = b0 * x(k-2) + b1 * x(k-1) + b2 * x(k).  Since x(k-2)
+                // = x0 + x1, x(k-1) = x0 + x2, and x(k) = x0 + t, this is
+                // (b0+b1+b2) * x0 + b0 * x1 + b1 * x2 + b2 * t.
+                float b0 = (float) (g1 + g2 + 1) ;
+                float b1 = (float) (g2 + 1) ;
+                GRB_TRY (GrB_apply (x0, NULL, NULL, GrB_TIMES_FP32, x0,
+                    b0 + b1 + 1, NULL)) ;
+                GRB_TRY (GrB_apply (x1, NULL, NULL, GrB_TIMES_FP32, x1, b0,
+                    NULL)) ;
+                GRB_TRY (GrB_apply (x2, NULL, NULL, GrB_TIMES_FP32, x2, b1,
+                    NULL)) ;
+                GRB_TRY (GrB_eWiseAdd (r, NULL, NULL, GrB_PLUS_FP32, x0, t,
+                    NULL)) ;
+                GRB_TRY (GrB_eWiseAdd (r, NULL, GrB_PLUS_FP32, GrB_PLUS_FP32,
+                    x1, x2, NULL)) ;
+                // r = r / sum (r)
+                float rsum = 0 ;
+                GRB_TRY (GrB_reduce (&rsum, NULL, GrB_PLUS_MONOID_FP32, r,
+                    NULL)) ;
+                if (rsum > 0)
+                {
+                    GRB_TRY (GrB_apply (r, NULL, NULL, GrB_DIV_FP32, r, rsum,
+                        NULL)) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*centrality) = r ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
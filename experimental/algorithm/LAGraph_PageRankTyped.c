@@ -0,0 +1,203 @@
+//------------------------------------------------------------------------------
+// LAGraph_PageRankTyped: PageRank in single, double, or mixed precision
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_PageRankTyped computes the same PageRank as LAGr_PageRank (or
+// LAGr_PageRankGAP, if gap is true), but with a selectable precision:
+
+//  LAGraph_PageRank_FP32:  all vectors are GrB_FP32, and all work is done in
+//      single precision.  This is the same as LAGr_PageRank.
+//  LAGraph_PageRank_FP64:  all vectors are GrB_FP64, and all work is done in
+//      double precision.  This takes twice the memory traffic of FP32 for the
+//      vectors, but ranks of very large graphs, which can be close to the FP32
+//      epsilon, are computed accurately and a tight tol can be met.
+//  LAGraph_PageRank_Mixed: all vectors are GrB_FP32, but the semiring, the
+//      sums of the sinks, and the reductions for the convergence test are all
+//      done in double precision.  The FP32 values are typecast to double as
+//      they are read, and the results are rounded to FP32 only when stored.
+
+// The centrality vector has type GrB_FP64 for LAGraph_PageRank_FP64, and
+// GrB_FP32 otherwise.
+
+// If gap is true, sinks are ignored, as in LAGr_PageRankGAP (for the GAP
+// benchmark only), and reaching itermax is not an error.
+
+// This is an Advanced algorithm (G->AT and G->out_degree are required), with
+// the same requirements as LAGr_PageRank.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&d) ;                 \
+    GrB_free (&t) ;                 \
+    GrB_free (&w) ;                 \
+    GrB_free (&sink) ;              \
+    GrB_free (&rsink) ;             \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (&r) ;                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_PageRankTyped
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    LAGraph_PageRank_Precision precision,   // FP32, FP64, or mixed
+    bool gap,               // if true, ignore sinks as LAGr_PageRankGAP does
+    double damping,         // damping factor (typically 0.85)
+    double tol,             // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector r = NULL, d = NULL, t = NULL, w = NULL ;
+    GrB_Vector sink = NULL, rsink = NULL ;
+    LG_ASSERT (centrality != NULL && iters != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // select the types and operators
+    //--------------------------------------------------------------------------
+
+    // The vectors are held in the storage type.  The operators all take the
+    // work type, so any FP32 inputs are typecast to FP64 in the mixed case.
+    GrB_Type storage_type = NULL ;
+    GrB_BinaryOp plus_op = NULL, minus_op = NULL, div_op = NULL ;
+    GrB_UnaryOp abs_op = NULL ;
+    GrB_Monoid plus_monoid = NULL ;
+    GrB_Semiring plus_second = NULL ;
+    switch (precision)
+    {
+        case LAGraph_PageRank_FP32 :
+            storage_type = GrB_FP32 ;
+            plus_op      = GrB_PLUS_FP32 ;
+            minus_op     = GrB_MINUS_FP32 ;
+            div_op       = GrB_DIV_FP32 ;
+            abs_op       = GrB_ABS_FP32 ;
+            plus_monoid  = GrB_PLUS_MONOID_FP32 ;
+            plus_second  = LAGraph_plus_second_fp32 ;
+            break ;
+
+        case LAGraph_PageRank_FP64 :
+        case LAGraph_PageRank_Mixed :
+            storage_type = (precision == LAGraph_PageRank_FP64) ?
+                GrB_FP64 : GrB_FP32 ;
+            plus_op      = GrB_PLUS_FP64 ;
+            minus_op     = GrB_MINUS_FP64 ;
+            div_op       = GrB_DIV_FP64 ;
+            abs_op       = GrB_ABS_FP64 ;
+            plus_monoid  = GrB_PLUS_MONOID_FP64 ;
+            plus_second  = LAGraph_plus_second_fp64 ;
+            break ;
+
+        default :
+            LG_ASSERT_MSG (false, GrB_INVALID_VALUE, "invalid precision") ;
+            break ;
+    }
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    // get AT, the sinks (unless they are ignored), and
+    // d = max (d_out / damping, 1 / damping)
+    GrB_Matrix AT ;
+    GrB_Index nsinks ;
+    LG_TRY (LG_PageRank_Setup (&AT, &d, gap ? NULL : &sink, &nsinks, G,
+        storage_type, damping, msg)) ;
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, AT)) ;
+
+    const double damping_over_n = damping / n ;
+    const double scaled_damping = (1 - damping) / n ;
+    double rdiff = 1 ;      // first iteration is always done
+
+    // r = 1 / n
+    GRB_TRY (GrB_Vector_new (&t, storage_type, n)) ;
+    GRB_TRY (GrB_Vector_new (&r, storage_type, n)) ;
+    GRB_TRY (GrB_Vector_new (&w, storage_type, n)) ;
+    GRB_TRY (GrB_assign (r, NULL, NULL, 1.0 / n, GrB_ALL, n, NULL)) ;
+
+    if (nsinks > 0)
+    {
+        GRB_TRY (GrB_Vector_new (&rsink, storage_type, n)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pagerank iterations
+    //--------------------------------------------------------------------------
+
+    for ((*iters) = 0 ; rdiff > tol ; (*iters)++)
+    {
+        // check for convergence
+        if ((*iters) >= itermax)
+        {
+            // the GAP benchmark simply stops at itermax
+            if (gap) break ;
+            LG_ASSERT_MSGF (false, LAGRAPH_CONVERGENCE_FAILURE,
+                "pagerank failed to converge in %d iterations", itermax) ;
+        }
+        // determine teleport and handle any sinks
+        double teleport = scaled_damping ; // teleport = (1 - damping) / n
+        if (nsinks > 0)
+        {
+            // handle the sinks: teleport += (damping/n) * sum (r (sink))
+            GRB_TRY (GrB_Vector_clear (rsink)) ;
+            GRB_TRY (GrB_assign (rsink, sink, NULL, r, GrB_ALL, n, GrB_DESC_S));
+            double sum_rsink = 0 ;
+            GRB_TRY (GrB_reduce (&sum_rsink, NULL, plus_monoid, rsink, NULL)) ;
+            teleport += damping_over_n * sum_rsink ;
+        }
+        // swap t and r ; now t is the old score
+        GrB_Vector temp = t ; t = r ; r = temp ;
+        // w = t ./ d
+        GRB_TRY (GrB_eWiseMult (w, NULL, NULL, div_op, t, d, NULL)) ;
+        // r = teleport
+        GRB_TRY (GrB_assign (r, NULL, NULL, teleport, GrB_ALL, n, NULL)) ;
+        // r += A'*w
+        GRB_TRY (GrB_mxv (r, NULL, plus_op, plus_second, AT, w, NULL)) ;
+        // t = abs (t - r)
+        GRB_TRY (GrB_assign (t, NULL, minus_op, r, GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_apply (t, NULL, NULL, abs_op, t, NULL)) ;
+        // rdiff = sum (t)
+        GRB_TRY (GrB_reduce (&rdiff, NULL, plus_monoid, t, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*centrality) = r ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,283 @@
+//------------------------------------------------------------------------------
+// LAGraph_PersonalizedPageRank: personalized PageRank, one or many at a time
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_PersonalizedPageRank_Batch computes k personalized PageRanks at the
+// same time.  Column j of the n-by-k matrix P is the personalization (or
+// teleport) vector of the jth problem.  P is typically very sparse, with just
+// a few seed nodes in each column.  Its entries must not be negative, and
+// each column is scaled so that it sums to one.  The result is an n-by-k
+// matrix, where column j is the PageRank with the teleport vector P(:,j):
+
+//      R(:,j) = (1-damping) * P(:,j) + damping * (A' * D^-1 * R(:,j)
+//               + P(:,j) * sum (R(sinks,j)))
+
+// where D holds the out-degrees of the nodes.  Unlike LAGr_PageRank, where
+// both the teleport and the rank of the sinks are spread over all nodes, here
+// they are both sent back to the nodes in P(:,j), which keeps each column of
+// R summing to one, just like LAGr_PageRank.  If P(:,j) is the dense vector
+// 1/n, R(:,j) is the same as the centrality from LAGr_PageRank.
+
+// All k problems are iterated together, with a single GrB_mxm with G->AT per
+// iteration.  The iterations stop when the 1-norm of the change in each
+// column of R is at most tol.
+
+// LAGraph_PersonalizedPageRank computes a single personalized PageRank, with
+// the personalization given as a sparse vector.
+
+// This is an Advanced algorithm (G->AT and G->out_degree are required), with
+// the same requirements as LAGr_PageRank.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&P1) ;                \
+    GrB_free (&D) ;                 \
+    GrB_free (&Dc) ;                \
+    GrB_free (&T) ;                 \
+    GrB_free (&W) ;                 \
+    GrB_free (&d) ;                 \
+    GrB_free (&c) ;                 \
+    GrB_free (&sink) ;              \
+    GrB_free (&rsink) ;             \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (&R) ;                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_PersonalizedPageRank_Batch
+(
+    // output:
+    GrB_Matrix *centrality, // centrality(i,j): pagerank of node i, for the
+                            // jth personalization vector
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Matrix P,     // n-by-k matrix of personalization vectors
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix R = NULL, P1 = NULL, D = NULL, Dc = NULL, T = NULL, W = NULL ;
+    GrB_Vector d = NULL, c = NULL, sink = NULL, rsink = NULL ;
+    LG_ASSERT (centrality != NULL && iters != NULL && P != NULL,
+        GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+
+    // get AT, the sinks, and d = max (d_out / damping, 1 / damping)
+    GrB_Matrix AT ;
+    GrB_Index nsinks ;
+    LG_TRY (LG_PageRank_Setup (&AT, &d, &sink, &nsinks, G, GrB_FP32, damping,
+        msg)) ;
+
+    GrB_Index n, pnrows, k ;
+    GRB_TRY (GrB_Matrix_nrows (&n, AT)) ;
+    GRB_TRY (GrB_Matrix_nrows (&pnrows, P)) ;
+    GRB_TRY (GrB_Matrix_ncols (&k, P)) ;
+    LG_ASSERT_MSG (pnrows == n, GrB_DIMENSION_MISMATCH,
+        "P must have n rows") ;
+
+    //--------------------------------------------------------------------------
+    // P1 = P scaled so that each column sums to one
+    //--------------------------------------------------------------------------
+
+    // c = sum (P) and its smallest entry, for each column of P
+    float pmin = 0, csum_min = 0 ;
+    GrB_Index cnvals ;
+    GRB_TRY (GrB_Matrix_new (&P1, GrB_FP32, n, k)) ;
+    GRB_TRY (GrB_assign (P1, NULL, NULL, P, GrB_ALL, n, GrB_ALL, k, NULL)) ;
+    GRB_TRY (GrB_reduce (&pmin, NULL, GrB_MIN_MONOID_FP32, P1, NULL)) ;
+    LG_ASSERT_MSG (pmin >= 0, GrB_INVALID_VALUE,
+        "P must not have negative entries") ;
+    GRB_TRY (GrB_Vector_new (&c, GrB_FP32, k)) ;
+    GRB_TRY (GrB_reduce (c, NULL, NULL, GrB_PLUS_MONOID_FP32, P1,
+        GrB_DESC_T0)) ;
+    GRB_TRY (GrB_Vector_nvals (&cnvals, c)) ;
+    GRB_TRY (GrB_reduce (&csum_min, NULL, GrB_MIN_MONOID_FP32, c, NULL)) ;
+    LG_ASSERT_MSG (cnvals == k && csum_min > 0, GrB_INVALID_VALUE,
+        "each column of P must have a positive sum") ;
+
+    // P1 = P1 * diag (1 ./ c)
+    GRB_TRY (GrB_apply (c, NULL, NULL, GrB_MINV_FP32, c, NULL)) ;
+    GRB_TRY (GrB_Matrix_diag (&Dc, c, 0)) ;
+    GRB_TRY (GrB_mxm (P1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32, P1, Dc,
+        NULL)) ;
+    GRB_TRY (GrB_free (&Dc)) ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    const float teleport = 1 - damping ;
+    float rdiff = 1 ;       // first iteration is always done
+
+    // R = P1
+    GRB_TRY (GrB_Matrix_dup (&R, P1)) ;
+    GRB_TRY (GrB_Matrix_new (&T, GrB_FP32, n, k)) ;
+    GRB_TRY (GrB_Matrix_new (&W, GrB_FP32, n, k)) ;
+
+    if (nsinks > 0)
+    {
+        GRB_TRY (GrB_Vector_new (&rsink, GrB_FP32, k)) ;
+    }
+
+    // D = diag (damping ./ max (d_out, 1)) = diag (1 ./ d), prescaled with
+    // the damping factor so it isn't done each iteration
+    GRB_TRY (GrB_apply (d, NULL, NULL, GrB_MINV_FP32, d, NULL)) ;
+    GRB_TRY (GrB_Matrix_diag (&D, d, 0)) ;
+
+    //--------------------------------------------------------------------------
+    // pagerank iterations, for all k problems at once
+    //--------------------------------------------------------------------------
+
+    for ((*iters) = 0 ; rdiff > tol ; (*iters)++)
+    {
+        // check for convergence
+        LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+            "pagerank failed to converge in %d iterations", itermax) ;
+
+        // c = teleport, for each of the k problems
+        GRB_TRY (GrB_assign (c, NULL, NULL, teleport, GrB_ALL, k, NULL)) ;
+        if (nsinks > 0)
+        {
+            // handle the sinks: c += damping * sum (R (sink,:))
+            GRB_TRY (GrB_mxv (rsink, NULL, NULL, LAGraph_plus_first_fp32, R,
+                sink, GrB_DESC_T0)) ;
+            GRB_TRY (GrB_apply (rsink, NULL, NULL, GrB_TIMES_FP32, rsink,
+                damping, NULL)) ;
+            GRB_TRY (GrB_eWiseAdd (c, NULL, NULL, GrB_PLUS_FP32, c, rsink,
+                NULL)) ;
+        }
+
+        // swap T and R ; now T is the old score
+        GrB_Matrix temp = T ; T = R ; R = temp ;
+
+        // W = D * T
+        GRB_TRY (GrB_mxm (W, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32, D, T,
+            NULL)) ;
+
+        // R = P1 * diag (c)
+        GRB_TRY (GrB_Matrix_diag (&Dc, c, 0)) ;
+        GRB_TRY (GrB_mxm (R, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32, P1, Dc,
+            NULL)) ;
+        GRB_TRY (GrB_free (&Dc)) ;
+
+        // R += A'*W
+        GRB_TRY (GrB_mxm (R, NULL, GrB_PLUS_FP32, LAGraph_plus_second_fp32,
+            AT, W, NULL)) ;
+
+        // T = abs (T - R)
+        GRB_TRY (GrB_eWiseAdd (T, NULL, NULL, GrB_MINUS_FP32, T, R, NULL)) ;
+        GRB_TRY (GrB_apply (T, NULL, NULL, GrB_ABS_FP32, T, NULL)) ;
+
+        // rdiff = max (sum (T)), the largest change of any of the k problems
+        GRB_TRY (GrB_Vector_clear (c)) ;
+        GRB_TRY (GrB_reduce (c, NULL, NULL, GrB_PLUS_MONOID_FP32, T,
+            GrB_DESC_T0)) ;
+        rdiff = 0 ;
+        GRB_TRY (GrB_reduce (&rdiff, NULL, GrB_MAX_MONOID_FP32, c, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*centrality) = R ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_PersonalizedPageRank: a single personalized PageRank
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&P) ;                 \
+    GrB_free (&R) ;                 \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (&r) ;                 \
+}
+
+int LAGraph_PersonalizedPageRank
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Vector p,     // personalization vector of size n
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix P = NULL, R = NULL ;
+    GrB_Vector r = NULL ;
+    LG_ASSERT (centrality != NULL && p != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // P = p, as an n-by-1 matrix, and solve the batch of one problem
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Vector_size (&n, p)) ;
+    GRB_TRY (GrB_Matrix_new (&P, GrB_FP32, n, 1)) ;
+    GRB_TRY (GrB_Col_assign (P, NULL, NULL, p, GrB_ALL, n, 0, NULL)) ;
+    LG_TRY (LAGraph_PersonalizedPageRank_Batch (&R, iters, G, P, damping, tol,
+        itermax, msg)) ;
+
+    // r = R (:,0)
+    GRB_TRY (GrB_Vector_new (&r, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Col_extract (r, NULL, NULL, R, GrB_ALL, n, 0, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*centrality) = r ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,316 @@
+//------------------------------------------------------------------------------
+// LAGraph_PointToPointSSSP: shortest path from a source to a single target
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_PointToPointSSSP finds the length of the shortest path from src to
+// dest, with the same delta-stepping method as LAGr_SingleSourceShortestPath,
+// but it stops as soon as the path length to dest is known, rather than
+// settling the whole graph.
+
+// Each node j that has been reached but not yet settled has a key, f(j) =
+// t(j) + h(j), where t(j) is its tentative path length and h(j) is an optional
+// lower bound on the length of the shortest path from j to dest.  Bucket k
+// holds the nodes with keys in the range k*Delta to (k+1)*Delta.  After each
+// bucket, any node with a key of at least t(dest) is pruned, since no path
+// through it can be shorter than the one already found.  The method stops
+// when no unsettled nodes remain.  If a node is pruned and later reached by a
+// shorter path, it is reached again.
+
+// If h is NULL, h(j) is zero for all j, and the buckets are the same as
+// LAGr_SingleSourceShortestPath.  Otherwise, this is an A* search: h must be
+// consistent (h(i) <= A(i,j) + h(j) for all edges, and h(dest) = 0), so that
+// the nodes far from dest, as estimated by h, are put in later buckets and
+// are likely to be pruned before their edges are ever relaxed.  Landmark
+// distances from LAGraph_MultiSourceSSSP give such an h: if d(L,:) holds the
+// path lengths from a landmark L, then h(j) = max (0, d(L,dest) - d(L,j)) is
+// consistent.  Entries not present in h are taken as zero.
+
+// The early exit and pruning require all edge weights to be non-negative.  If
+// the graph may have negative edge weights (G->emin is not known, or is
+// negative), h is ignored, the full single-source problem is solved, and
+// path_length (dest) is returned.
+
+// The path length is returned as a double, which is INFINITY if dest cannot be
+// reached from src.
+
+// This is an Advanced algorithm (G->emin is required for best performance).
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&AL) ;                \
+    GrB_free (&AH) ;                \
+    GrB_free (&uBound) ;            \
+    GrB_free (&tbest) ;             \
+    GrB_free (&infinity) ;          \
+    GrB_free (&t) ;                 \
+    GrB_free (&tmasked) ;           \
+    GrB_free (&tReq) ;              \
+    GrB_free (&tless) ;             \
+    GrB_free (&s) ;                 \
+    GrB_free (&reach) ;             \
+    GrB_free (&Empty) ;             \
+    GrB_free (&hk) ;                \
+    GrB_free (&key) ;               \
+}
+
+#define LG_FREE_ALL LG_FREE_WORK
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_PointToPointSSSP
+(
+    // output:
+    double *path_length,        // length of the shortest path from src to
+                                // dest, or INFINITY if dest is not reachable
+    // inputs:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Index src,              // source node
+    GrB_Index dest,             // target node
+    GrB_Scalar Delta,           // delta value for delta stepping
+    GrB_Vector h,               // optional lower bound on the path length from
+                                // each node to dest (may be NULL)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix AL = NULL ;          // the light weight edges
+    GrB_Matrix AH = NULL ;          // the heavy weight edges
+    GrB_Scalar uBound = NULL ;      // upper bound of the current bucket
+    GrB_Scalar tbest = NULL ;       // path length to dest found so far
+    GrB_Scalar infinity = NULL ;    // path length of unreachable nodes
+    GrB_Vector t = NULL ;           // tentative shortest path lengths
+    GrB_Vector tmasked = NULL ;     // the entries of t in the current bucket
+    GrB_Vector tReq = NULL ;        // requested path lengths
+    GrB_Vector tless = NULL ;       // tless (j) is true if tReq (j) < t (j)
+    GrB_Vector s = NULL ;           // nodes in the current bucket
+    GrB_Vector reach = NULL ;       // nodes reached but not yet settled
+    GrB_Vector Empty = NULL ;
+    GrB_Vector hk = NULL ;          // the lower bounds h, as FP64
+    GrB_Vector key = NULL ;         // key (j) = t (j) + h (j)
+
+    LG_ASSERT (path_length != NULL && Delta != NULL, GrB_NULL_POINTER) ;
+    (*path_length) = INFINITY ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Index nvals ;
+    GRB_TRY (GrB_Scalar_nvals (&nvals, Delta)) ;
+    LG_ASSERT_MSG (nvals == 1, GrB_EMPTY_OBJECT, "Delta is missing") ;
+    double delta = 0 ;
+    GRB_TRY (GrB_Scalar_extractElement_FP64 (&delta, Delta)) ;
+    LG_ASSERT_MSG (delta > 0, GrB_INVALID_VALUE, "Delta must be > 0") ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    LG_ASSERT_MSG (src < n && dest < n, GrB_INVALID_INDEX,
+        "invalid source or target node") ;
+    if (h != NULL)
+    {
+        GrB_Index hsize ;
+        GRB_TRY (GrB_Vector_size (&hsize, h)) ;
+        LG_ASSERT_MSG (hsize == n, GrB_DIMENSION_MISMATCH,
+            "h must have size n") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // select the operators for the type of G->A
+    //--------------------------------------------------------------------------
+
+    LG_SSSP_Operators ops ;
+    LG_TRY (LG_SSSP_GetOperators (&ops, &infinity, G, msg)) ;
+    GrB_Type etype = ops.type ;
+    GrB_IndexUnaryOp le = ops.le, gt = ops.gt ;
+    GrB_BinaryOp less_than = ops.less_than ;
+    GrB_Semiring min_plus = ops.min_plus ;
+    double tinf = ops.infinity ;    // t (j) for nodes not yet reached
+    bool early_exit = !ops.negative_edge_weights ;
+
+    // t (:) = infinity
+    GRB_TRY (GrB_Vector_new (&t, etype, n)) ;
+    GRB_TRY (GrB_Vector_assign_Scalar (t, NULL, NULL, infinity, GrB_ALL, n,
+        NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Scalar_new (&uBound, GrB_FP64)) ;
+    GRB_TRY (GrB_Scalar_new (&tbest, GrB_FP64)) ;
+    GRB_TRY (GrB_Vector_new (&tmasked, etype, n)) ;
+    GRB_TRY (GrB_Vector_new (&tReq, etype, n)) ;
+    GRB_TRY (GrB_Vector_new (&tless, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&s, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&reach, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&Empty, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&hk, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&key, GrB_FP64, n)) ;
+
+    // hk = h, if present and used; otherwise hk is empty and all keys are t
+    if (h != NULL && early_exit)
+    {
+        GRB_TRY (GrB_assign (hk, NULL, NULL, h, GrB_ALL, n, NULL)) ;
+    }
+
+    // t (src) = 0, reach (src) = true, s (src) = true
+    GRB_TRY (GrB_Vector_setElement (t, 0, src)) ;
+    GRB_TRY (GrB_Vector_setElement (reach, true, src)) ;
+    GRB_TRY (GrB_Vector_setElement (s, true, src)) ;
+
+    // AL = A .* (A <= Delta), and AH = A .* (A > Delta)
+    GRB_TRY (GrB_Matrix_new (&AL, etype, n, n)) ;
+    GRB_TRY (GrB_select (AL, NULL, NULL, le, A, Delta, NULL)) ;
+    GRB_TRY (GrB_wait (AL, GrB_MATERIALIZE)) ;
+    GRB_TRY (GrB_Matrix_new (&AH, etype, n, n)) ;
+    GRB_TRY (GrB_select (AH, NULL, NULL, gt, A, Delta, NULL)) ;
+    GRB_TRY (GrB_wait (AH, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // process the buckets in order until no unsettled nodes remain
+    //--------------------------------------------------------------------------
+
+    for (int64_t step = 0 ; ; step++)
+    {
+
+        //----------------------------------------------------------------------
+        // key<reach> = t + h, and skip over any empty buckets
+        //----------------------------------------------------------------------
+
+        GRB_TRY (GrB_eWiseAdd (key, reach, NULL, GrB_PLUS_FP64, t, hk,
+            GrB_DESC_RS)) ;
+        double kmin = 0 ;
+        GRB_TRY (GrB_reduce (&kmin, NULL, GrB_MIN_MONOID_FP64, key, NULL)) ;
+        step = LAGRAPH_MAX (step, (int64_t) floor (kmin / delta)) ;
+
+        //----------------------------------------------------------------------
+        // tmasked = all entries in t<reach> with keys less than (step+1)*Delta
+        //----------------------------------------------------------------------
+
+        GRB_TRY (GrB_Scalar_setElement_FP64 (uBound, (step+1) * delta)) ;
+        GRB_TRY (GrB_select (key, NULL, NULL, GrB_VALUELT_FP64, key, uBound,
+            NULL)) ;
+        GRB_TRY (GrB_assign (tmasked, key, NULL, t, GrB_ALL, n,
+            GrB_DESC_RS)) ;
+        GrB_Index tmasked_nvals ;
+        GRB_TRY (GrB_Vector_nvals (&tmasked_nvals, tmasked)) ;
+
+        //----------------------------------------------------------------------
+        // relax the light edges while the current bucket is not empty
+        //----------------------------------------------------------------------
+
+        while (tmasked_nvals > 0)
+        {
+            // tReq = tmasked min.+ AL
+            GRB_TRY (GrB_vxm (tReq, NULL, NULL, min_plus, tmasked, AL, NULL)) ;
+
+            // s<struct(tmasked)> = true
+            GRB_TRY (GrB_assign (s, tmasked, NULL, (bool) true, GrB_ALL, n,
+                GrB_DESC_S)) ;
+
+            GrB_Index tReq_nvals ;
+            GRB_TRY (GrB_Vector_nvals (&tReq_nvals, tReq)) ;
+            if (tReq_nvals == 0) break ;
+
+            // tless = (tReq .< t), with its false entries removed
+            GRB_TRY (GrB_eWiseMult (tless, NULL, NULL, less_than, tReq, t,
+                NULL)) ;
+            GRB_TRY (GrB_select (tless, NULL, NULL, GrB_VALUEEQ_BOOL, tless,
+                true, NULL)) ;
+            GrB_Index tless_nvals ;
+            GRB_TRY (GrB_Vector_nvals (&tless_nvals, tless)) ;
+            if (tless_nvals == 0) break ;
+
+            // reach<struct(tless)> = true
+            GRB_TRY (GrB_assign (reach, tless, NULL, (bool) true, GrB_ALL, n,
+                GrB_DESC_S)) ;
+
+            // tmasked<struct(tless)> = tReq, for keys in the current bucket
+            GRB_TRY (GrB_eWiseAdd (key, tless, NULL, GrB_PLUS_FP64, tReq, hk,
+                GrB_DESC_RS)) ;
+            GRB_TRY (GrB_select (key, NULL, NULL, GrB_VALUELT_FP64, key,
+                uBound, NULL)) ;
+            GRB_TRY (GrB_assign (tmasked, key, NULL, tReq, GrB_ALL, n,
+                GrB_DESC_RS)) ;
+
+            // t<struct(tless)> = tReq
+            GRB_TRY (GrB_assign (t, tless, NULL, tReq, GrB_ALL, n, GrB_DESC_S));
+            GRB_TRY (GrB_Vector_nvals (&tmasked_nvals, tmasked)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // relax the heavy edges of all nodes settled in this bucket
+        //----------------------------------------------------------------------
+
+        // tmasked<s> = t
+        GRB_TRY (GrB_assign (tmasked, s, NULL, t, GrB_ALL, n, GrB_DESC_RS)) ;
+
+        // t<tless> = tReq, where tReq = tmasked min.+ AH and tless = tReq .< t
+        GRB_TRY (GrB_vxm (tReq, NULL, NULL, min_plus, tmasked, AH, NULL)) ;
+        GRB_TRY (GrB_eWiseMult (tless, NULL, NULL, less_than, tReq, t, NULL)) ;
+        GRB_TRY (GrB_assign (t, tless, NULL, tReq, GrB_ALL, n, NULL)) ;
+
+        // reach<tless> = true, and remove the nodes settled in this bucket
+        GRB_TRY (GrB_assign (reach, tless, NULL, (bool) true, GrB_ALL, n,
+            NULL)) ;
+        GRB_TRY (GrB_assign (reach, s, NULL, Empty, GrB_ALL, n, GrB_DESC_S)) ;
+
+        //----------------------------------------------------------------------
+        // prune the nodes that cannot lead to a shorter path to dest
+        //----------------------------------------------------------------------
+
+        if (early_exit)
+        {
+            double best = INFINITY ;
+            GRB_TRY (GrB_Vector_extractElement_FP64 (&best, t, dest)) ;
+            if (best != tinf)
+            {
+                // dest has been reached
+                // key<reach> = t + h
+                GRB_TRY (GrB_eWiseAdd (key, reach, NULL, GrB_PLUS_FP64, t, hk,
+                    GrB_DESC_RS)) ;
+                // key = select (key >= best)
+                GRB_TRY (GrB_Scalar_setElement_FP64 (tbest, best)) ;
+                GRB_TRY (GrB_select (key, NULL, NULL, GrB_VALUEGE_FP64, key,
+                    tbest, NULL)) ;
+                // reach<struct(key)> = empty
+                GRB_TRY (GrB_assign (reach, key, NULL, Empty, GrB_ALL, n,
+                    GrB_DESC_S)) ;
+            }
+        }
+
+        GrB_Index nreach ;
+        GRB_TRY (GrB_Vector_nvals (&nreach, reach)) ;
+        if (nreach == 0) break ;
+        GRB_TRY (GrB_Vector_clear (s)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    double result = INFINITY ;
+    GRB_TRY (GrB_Vector_extractElement_FP64 (&result, t, dest)) ;
+    (*path_length) = (result == tinf) ? INFINITY : result ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
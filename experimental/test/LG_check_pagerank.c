@@ -0,0 +1,99 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/LG_check_pagerank.c: shared PageRank test fixture
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// The graphs and the comparison used by the tests of the PageRank variants:
+// LAGraph_PageRankSolver, LAGraph_PersonalizedPageRank, LAGraph_PageRankTyped,
+// and LAGraph_PageRankIncremental.
+
+#define LG_FREE_ALL                 \
+{                                   \
+    GrB_free (&diff) ;              \
+}
+
+#include "LG_internal.h"
+#include "LG_test.h"
+#include "LG_Xtest.h"
+
+//------------------------------------------------------------------------------
+// LG_check_pagerank_graph: the kth graph of the PageRank tests
+//------------------------------------------------------------------------------
+
+// Returns the name of the kth Matrix Market file (in LAGraph/data) used by
+// the PageRank tests, and the kind of graph to construct from it, or NULL if
+// k is past the end of the list.
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+static const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "bcsstk13.mtx",
+} ;
+
+const char *LG_check_pagerank_graph
+(
+    // output:
+    LAGraph_Kind *kind,     // kind of the kth graph
+    // input:
+    int k
+)
+{
+    int nfiles = (int) (sizeof (files) / sizeof (matrix_info)) ;
+    if (k < 0 || k >= nfiles) return (NULL) ;
+    if (kind != NULL) (*kind) = files [k].kind ;
+    return (files [k].name) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_check_pagerank_diff: err = max (abs (x-y))
+//------------------------------------------------------------------------------
+
+// x and y may have any real type; the difference is computed in double
+// precision.
+
+int LG_check_pagerank_diff
+(
+    // output:
+    double *err,            // max (abs (x-y))
+    // input:
+    GrB_Vector x,
+    GrB_Vector y,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    GrB_Vector diff = NULL ;
+    LG_ASSERT (err != NULL, GrB_NULL_POINTER) ;
+    (*err) = 0 ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Vector_size (&n, x)) ;
+    GRB_TRY (GrB_Vector_new (&diff, GrB_FP64, n)) ;
+    GRB_TRY (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP64, x, y, NULL)) ;
+    GRB_TRY (GrB_apply (diff, NULL, NULL, GrB_ABS_FP64, diff, NULL)) ;
+    GRB_TRY (GrB_reduce (err, NULL, GrB_MAX_MONOID_FP64, diff, NULL)) ;
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -58,4 +58,24 @@ int LG_check_kcore_decompose
     char *msg
 ) ;
 
+// the graphs used by the PageRank tests: returns the name of the kth file in
+// LAGraph/data, or NULL if k is past the end of the list
+const char *LG_check_pagerank_graph
+(
+    // output:
+    LAGraph_Kind *kind,     // kind of the kth graph
+    // input:
+    int k
+) ;
+
+int LG_check_pagerank_diff  // err = max (abs (x-y)), in double precision
+(
+    // output:
+    double *err,
+    // input:
+    GrB_Vector x,
+    GrB_Vector y,
+    char *msg
+) ;
+
 #endif
@@ -0,0 +1,173 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_ApproxBetweenness.c: test cases for
+// LAGraph_ApproxBetweenness
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector exact = NULL, c = NULL, c2 = NULL, diff = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGRAPH_UNKNOWN,              ""
+} ;
+
+// max (abs (x-y))
+static double difference (GrB_Vector x, GrB_Vector y)
+{
+    GrB_Index n ;
+    OK (GrB_Vector_size (&n, x)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP64, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP64, x, y, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP64, diff, NULL)) ;
+    double err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP64, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err) ;
+}
+
+//****************************************************************************
+
+void test_ApproxBetweenness (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    OK (LAGraph_Random_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the graph
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        // exact centrality (this also computes G->AT, if needed)
+        OK (LAGraph_Betweenness (&exact, G, 0, msg)) ;
+
+        double epsilon = 0.05, delta = 0.1 ;
+        int64_t kmax = (int64_t) ceil ((log ((double) n) + log (4 / delta)) /
+            (2 * epsilon * epsilon)) ;
+        int32_t batch_sizes [3] = { 0, 7, 200 } ;
+        for (int kk = 0 ; kk < 3 ; kk++)
+        {
+            int64_t nsamples = 0, nsamples2 = 0 ;
+            OK (LAGraph_ApproxBetweenness (&c, &nsamples, G, epsilon, delta,
+                batch_sizes [kk], 42, msg)) ;
+            double err = difference (c, exact) / ((double) n * (n-1)) ;
+            printf ("batch %d: samples %g (max %g), err %g\n",
+                batch_sizes [kk], (double) nsamples, (double) kmax, err) ;
+            TEST_CHECK (nsamples > 0) ;
+            TEST_CHECK (nsamples < kmax + 200) ;
+            TEST_CHECK (err <= epsilon) ;
+
+            // the result is reproducible for the same seed
+            OK (LAGraph_ApproxBetweenness (&c2, &nsamples2, G, epsilon, delta,
+                batch_sizes [kk], 42, msg)) ;
+            TEST_CHECK (nsamples == nsamples2) ;
+            TEST_CHECK (difference (c, c2) == 0) ;
+            OK (GrB_free (&c)) ;
+            OK (GrB_free (&c2)) ;
+        }
+
+        OK (GrB_free (&exact)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Random_Finalize (msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//****************************************************************************
+
+void test_ApproxBetweenness_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    OK (LAGraph_Random_Init (msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    int64_t nsamples = 0 ;
+
+    // G->AT is missing
+    int result = LAGraph_ApproxBetweenness (&c, &nsamples, G, 0.1, 0.1, 0, 1,
+        msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (c == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+
+    // invalid epsilon, delta, and batch_size
+    result = LAGraph_ApproxBetweenness (&c, &nsamples, G, 0, 0.1, 0, 1, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_ApproxBetweenness (&c, &nsamples, G, 0.1, 1, 0, 1, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_ApproxBetweenness (&c, &nsamples, G, 0.1, 0.1, -1, 1,
+        msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    result = LAGraph_ApproxBetweenness (NULL, &nsamples, G, 0.1, 0.1, 0, 1,
+        msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_ApproxBetweenness (&c, NULL, G, 0.1, 0.1, 0, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Random_Finalize (msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"ApproxBetweenness", test_ApproxBetweenness},
+    {"ApproxBetweenness_errors", test_ApproxBetweenness_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,160 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_ApproxTriangleCount.c: test cases for
+// LAGraph_ApproxTriangleCount
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    uint64_t ntriangles ;           // # triangles in original matrix
+    const char *name ;              // matrix filename
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    {     45, "karate.mtx" },
+    {   2016, "jagmesh7.mtx" },
+    {      0, "LFAT5.mtx" },
+    { 342300, "bcsstk13.mtx" },
+    {      0, "" },
+} ;
+
+//****************************************************************************
+
+void test_ApproxTriangleCount (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the graph
+        const char *aname = files [k].name ;
+        double ntriangles = (double) files [k].ntriangles ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+        // with p = 1, the result is exact
+        double est, lo, hi, est2, lo2, hi2 ;
+        OK (LAGraph_ApproxTriangleCount (&est, &lo, &hi, G, 1, 1.96, 1, msg)) ;
+        printf ("exact: %g [%g %g]\n", est, lo, hi) ;
+        TEST_CHECK (est == ntriangles && lo == ntriangles &&
+            hi == ntriangles) ;
+
+        // sample the edges, with many seeds.  With p = 0.3, about a third of
+        // all seeds keep no triangles of karate.mtx at all, but the interval
+        // must still hold the exact count.
+        double prob [3] = { 0.8, 0.5, 0.3 } ;
+        for (int kk = 0 ; kk < 3 ; kk++)
+        {
+            double p = prob [kk] ;
+            int ncovered = 0, nseeds = 100 ;
+            for (int seed = 1 ; seed <= nseeds ; seed++)
+            {
+                OK (LAGraph_ApproxTriangleCount (&est, &lo, &hi, G, p, 3,
+                    (uint64_t) seed, msg)) ;
+                TEST_CHECK (lo <= est && est <= hi) ;
+                if (lo <= ntriangles && ntriangles <= hi) ncovered++ ;
+
+                // the result is reproducible for the same seed
+                OK (LAGraph_ApproxTriangleCount (&est2, &lo2, &hi2, G, p, 3,
+                    (uint64_t) seed, msg)) ;
+                TEST_CHECK (est == est2 && lo == lo2 && hi == hi2) ;
+            }
+            printf ("p %g: last estimate %g [%g %g], exact %g, "
+                "covered by %d of %d seeds\n", p, est, lo, hi, ntriangles,
+                ncovered, nseeds) ;
+            TEST_CHECK (ncovered >= 95) ;
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//****************************************************************************
+
+void test_ApproxTriangleCount_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    double est, lo, hi ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    // G must be symmetric
+    int result = LAGraph_ApproxTriangleCount (&est, &lo, &hi, G, 0.5, 2, 1,
+        msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    // invalid p and z
+    result = LAGraph_ApproxTriangleCount (&est, &lo, &hi, G, 0, 2, 1, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_ApproxTriangleCount (&est, &lo, &hi, G, 1.5, 2, 1, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_ApproxTriangleCount (&est, &lo, &hi, G, 0.5, -1, 1, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    result = LAGraph_ApproxTriangleCount (NULL, &lo, &hi, G, 0.5, 2, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"ApproxTriangleCount", test_ApproxTriangleCount},
+    {"ApproxTriangleCount_errors", test_ApproxTriangleCount_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,176 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_BidirectionalBFS.c: test LAGraph_BidirectionalBFS
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector level = NULL, path = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "ldbc-undirected-example.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "A.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGRAPH_UNKNOWN,              ""
+} ;
+
+//****************************************************************************
+
+void test_BidirectionalBFS (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the graph
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        int64_t nfound = 0 ;
+        for (GrB_Index src = 0 ; src < n ; src += LAGRAPH_MAX (1, n/20))
+        {
+            // get the levels of all nodes from src
+            OK (LAGr_BreadthFirstSearch (&level, NULL, G, src, msg)) ;
+
+            for (GrB_Index dest = 0 ; dest < n ; dest++)
+            {
+                // find the distance from src to dest, with the path
+                int64_t distance = -2, distance2 = -2, lev = -1 ;
+                OK (LAGraph_BidirectionalBFS (&distance, &path, G, src, dest,
+                    msg)) ;
+                int info = GrB_Vector_extractElement_INT64 (&lev, level, dest) ;
+                TEST_CHECK (info == GrB_SUCCESS || info == GrB_NO_VALUE) ;
+                TEST_CHECK (distance == lev) ;
+                TEST_MSG ("wrong distance from %g to %g: %g, expected %g",
+                    (double) src, (double) dest, (double) distance,
+                    (double) lev) ;
+
+                // check the path
+                GrB_Index len ;
+                OK (GrB_Vector_size (&len, path)) ;
+                TEST_CHECK (len == distance + 1) ;
+                int64_t prev = -1 ;
+                for (GrB_Index d = 0 ; d < len ; d++)
+                {
+                    int64_t node = -1 ;
+                    OK (GrB_Vector_extractElement_INT64 (&node, path, d)) ;
+                    if (d == 0) TEST_CHECK (node == src) ;
+                    if (d == len-1) TEST_CHECK (node == dest) ;
+                    if (d > 0)
+                    {
+                        // the edge (prev,node) must appear in the graph
+                        double x ;
+                        info = GrB_Matrix_extractElement_FP64 (&x, G->A,
+                            prev, node) ;
+                        TEST_CHECK (info == GrB_SUCCESS) ;
+                    }
+                    prev = node ;
+                }
+                OK (GrB_free (&path)) ;
+
+                // find the distance only
+                OK (LAGraph_BidirectionalBFS (&distance2, NULL, G, src, dest,
+                    msg)) ;
+                TEST_CHECK (distance2 == distance) ;
+                nfound += (distance >= 0) ;
+            }
+            OK (GrB_free (&level)) ;
+        }
+        printf ("# of reachable pairs: %g\n", (double) nfound) ;
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+void test_BidirectionalBFS_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    int64_t distance = 0 ;
+
+    // distance is NULL
+    int result = LAGraph_BidirectionalBFS (NULL, &path, G, 0, 1, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    TEST_CHECK (path == NULL) ;
+
+    // G->AT is required
+    result = LAGraph_BidirectionalBFS (&distance, &path, G, 0, 1, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (path == NULL) ;
+    TEST_CHECK (distance == -1) ;
+
+    // invalid destination
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    result = LAGraph_BidirectionalBFS (&distance, &path, G, 0, 67, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (path == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"BidirectionalBFS", test_BidirectionalBFS},
+    {"BidirectionalBFS_errors", test_BidirectionalBFS_errors},
+    {NULL, NULL}
+};
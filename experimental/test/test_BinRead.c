@@ -0,0 +1,206 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_BinRead.c: test LAGraph_BinRead and BinWrite
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+GrB_Matrix A = NULL, B = NULL, C = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "cover.mtx",
+    "cover_structure.mtx",
+    "jagmesh7.mtx",
+    "ldbc-directed-example.mtx",
+    "LFAT5.mtx",
+    "sources_7.mtx",
+    "west0067.mtx",
+    "lp_afiro.mtx",
+    "matrix_bool.mtx",
+    "matrix_int8.mtx",
+    "matrix_int16.mtx",
+    "matrix_int32.mtx",
+    "matrix_int64.mtx",
+    "matrix_uint8.mtx",
+    "matrix_uint16.mtx",
+    "matrix_uint32.mtx",
+    "matrix_uint64.mtx",
+    "matrix_fp32.mtx",
+    "matrix_fp64.mtx",
+    "west0067_jumbled.mtx",
+    "structure.mtx",
+    "full.mtx",
+    "empty.mtx",
+    "",
+} ;
+
+//****************************************************************************
+
+void test_BinRead (void)
+{
+    LAGraph_Init (msg) ;
+
+    #if LAGRAPH_SUITESPARSE
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the matrix as A
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (GrB_Matrix_dup (&C, A)) ;
+
+        // test all sparsity formats, by row and by column
+        for (int scon = 1 ; scon <= 8 ; scon = 2*scon)
+        {
+            for (int fmt = 0 ; fmt <= 1 ; fmt++)
+            {
+                OK (GxB_set (A, GxB_SPARSITY_CONTROL, scon)) ;
+                OK (GxB_set (A, GxB_FORMAT, fmt ? GxB_BY_ROW : GxB_BY_COL)) ;
+
+                // write A twice to a temporary file
+                f = tmpfile ( ) ;
+                TEST_CHECK (f != NULL) ;
+                OK (LAGraph_BinWrite (A, f, aname, msg)) ;
+                OK (LAGraph_BinWrite (A, f, NULL, msg)) ;
+
+                // A is unchanged
+                bool ok = false ;
+                OK (LAGraph_Matrix_IsEqual (&ok, A, C, msg)) ;
+                TEST_CHECK (ok) ;
+
+                // read both copies back in, which also checks that the file
+                // is left positioned just after the first matrix
+                rewind (f) ;
+                for (int trial = 0 ; trial < 2 ; trial++)
+                {
+                    OK (LAGraph_BinRead (&B, f, msg)) ;
+                    OK (LAGraph_Matrix_IsEqual (&ok, A, B, msg)) ;
+                    TEST_CHECK (ok) ;
+                    TEST_MSG ("Failed for %s, scon: %d fmt: %d\n", aname,
+                        scon, fmt) ;
+                    OK (GrB_free (&B)) ;
+                }
+
+                // no more matrices in the file
+                int result = LAGraph_BinRead (&B, f, msg) ;
+                TEST_CHECK (result == LAGRAPH_IO_ERROR) ;
+                TEST_CHECK (B == NULL) ;
+                fclose (f) ;
+            }
+        }
+
+        OK (GrB_free (&A)) ;
+        OK (GrB_free (&C)) ;
+    }
+    #endif
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+
+void test_BinRead_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    int result = LAGraph_BinRead (NULL, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_BinWrite (NULL, NULL, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    #if LAGRAPH_SUITESPARSE
+    // write a matrix and truncate it
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+
+    f = tmpfile ( ) ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_BinWrite (A, f, NULL, msg)) ;
+    long size = ftell (f) ;
+    rewind (f) ;
+    char *buffer = NULL ;
+    OK (LAGraph_Malloc ((void **) &buffer, size, sizeof (char), msg)) ;
+    TEST_CHECK (fread (buffer, sizeof (char), size, f) == size) ;
+    fclose (f) ;
+
+    for (long len = 0 ; len < size ; len += LAGRAPH_MAX (1, size / 17))
+    {
+        f = tmpfile ( ) ;
+        TEST_CHECK (f != NULL) ;
+        TEST_CHECK (fwrite (buffer, sizeof (char), len, f) == len) ;
+        rewind (f) ;
+        result = LAGraph_BinRead (&B, f, msg) ;
+        TEST_CHECK (result == LAGRAPH_IO_ERROR) ;
+        TEST_CHECK (B == NULL) ;
+        printf ("truncated to %ld: result %d msg: [%s]\n", len, result, msg) ;
+        fclose (f) ;
+    }
+
+    // corrupt the header so that the total length of the Ap, Ah, and Ai
+    // arrays of a hypersparse matrix overflows to zero
+    size_t p = LAGRAPH_BIN_HEADER + sizeof (GxB_Format_Value) ;
+    int32_t kind = GxB_HYPERSPARSE ;
+    memcpy (buffer + p, &kind, sizeof (int32_t)) ;
+    p += sizeof (int32_t) + sizeof (double) + 3 * sizeof (GrB_Index) ;
+    GrB_Index nvec = ((GrB_Index) 1) << 62 ;
+    GrB_Index nvals = (((GrB_Index) 1) << 63) - 1 ;
+    memcpy (buffer + p, &nvec, sizeof (GrB_Index)) ;
+    memcpy (buffer + p + sizeof (GrB_Index), &nvals, sizeof (GrB_Index)) ;
+    f = tmpfile ( ) ;
+    TEST_CHECK (f != NULL) ;
+    TEST_CHECK (fwrite (buffer, sizeof (char), size, f) == size) ;
+    rewind (f) ;
+    result = LAGraph_BinRead (&B, f, msg) ;
+    printf ("corrupt header: result %d msg: [%s]\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_IO_ERROR || result == GrB_OUT_OF_MEMORY) ;
+    TEST_CHECK (B == NULL) ;
+    fclose (f) ;
+
+    LAGraph_Free ((void **) &buffer, NULL) ;
+    OK (GrB_free (&A)) ;
+    #else
+    result = LAGraph_BinRead (&A, stdin, msg) ;
+    TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
+    #endif
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"BinRead", test_BinRead},
+    {"BinRead_errors", test_BinRead_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,280 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_IncrementalCC.c: test incremental CC
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+#include <LG_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL, Gk = NULL ;
+LAGraph_IncrementalCC cc = NULL ;
+GrB_Matrix A = NULL, L = NULL ;
+GrB_Vector C = NULL ;
+GrB_Index *I = NULL, *J = NULL, *W = NULL ;
+bool *X = NULL ;
+int64_t *Cx = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "karate.mtx",
+    "A.mtx",
+    "jagmesh7.mtx",
+    "LFAT5.mtx",
+    "LFAT5_two.mtx",
+    "tree-example.mtx",
+    "zenios.mtx",
+    ""
+} ;
+
+// Gk = the undirected graph with the first k edges (I [e], J [e])
+static void build_graph (GrB_Index n, GrB_Index k)
+{
+    OK (GrB_Matrix_new (&A, GrB_BOOL, n, n)) ;
+    OK (GrB_Matrix_build_BOOL (A, I, J, X, k, GrB_LOR)) ;
+    OK (GrB_eWiseAdd (A, NULL, NULL, GrB_LOR, A, A, GrB_DESC_T1)) ;
+    OK (LAGraph_New (&Gk, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+}
+
+// check the components of cc against the graph Gk
+static void check_components (GrB_Index n)
+{
+    OK (LAGraph_IncrementalCC_Component (&C, cc, msg)) ;
+    OK (LG_check_cc (C, Gk, msg)) ;
+
+    // each component is labeled with its smallest node
+    GrB_Index nvals = n ;
+    OK (GrB_Vector_extractTuples_INT64 (W, Cx, &nvals, C)) ;
+    TEST_CHECK (nvals == n) ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        TEST_CHECK (Cx [i] <= i) ;
+        TEST_CHECK (Cx [Cx [i]] == Cx [i]) ;
+    }
+    OK (GrB_free (&C)) ;
+}
+
+//****************************************************************************
+
+void test_IncrementalCC (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the graph
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        GrB_Index n, ne ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+
+        // get the edges of L = tril (A,-1), in a pseudo-random order
+        OK (GrB_Matrix_new (&L, GrB_BOOL, n, n)) ;
+        OK (GrB_select (L, NULL, NULL, GrB_TRIL, A, (int64_t) (-1), NULL)) ;
+        OK (GrB_free (&A)) ;
+        OK (GrB_Matrix_nvals (&ne, L)) ;
+        OK (LAGraph_Malloc ((void **) &I, ne+1, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &J, ne+1, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &X, ne+1, sizeof (bool), msg)) ;
+        OK (LAGraph_Malloc ((void **) &W, n, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &Cx, n, sizeof (int64_t), msg)) ;
+        OK (GrB_Matrix_extractTuples_BOOL (I, J, X, &ne, L)) ;
+        OK (GrB_free (&L)) ;
+        uint64_t seed = 42 ;
+        for (int64_t e = ne-1 ; e > 0 ; e--)
+        {
+            seed = seed * 6364136223846793005 + 1442695040888963407 ;
+            int64_t t = (seed >> 33) % (e+1) ;
+            GrB_Index ti = I [e] ; I [e] = I [t] ; I [t] = ti ;
+            GrB_Index tj = J [e] ; J [e] = J [t] ; J [t] = tj ;
+            // flip about half of the edges, so that I [e] < J [e] as well
+            if (seed & 1)
+            {
+                ti = I [e] ; I [e] = J [e] ; J [e] = ti ;
+            }
+        }
+
+        // start with the first half of the edges
+        GrB_Index nfirst = ne / 2 ;
+        build_graph (n, nfirst) ;
+        OK (LAGraph_IncrementalCC_New (&cc, Gk, msg)) ;
+        check_components (n) ;
+        OK (LAGraph_Delete (&Gk, msg)) ;
+
+        // insert the rest of the edges in 4 batches
+        for (int b = 0 ; b < 4 ; b++)
+        {
+            GrB_Index e1 = nfirst + ((ne - nfirst) * b) / 4 ;
+            GrB_Index e2 = nfirst + ((ne - nfirst) * (b+1)) / 4 ;
+            OK (LAGraph_IncrementalCC_Insert (cc, I + e1, J + e1, e2 - e1,
+                msg)) ;
+            build_graph (n, e2) ;
+            check_components (n) ;
+            OK (LAGraph_Delete (&Gk, msg)) ;
+        }
+
+        // inserting existing edges and self-edges does not change the result
+        OK (LAGraph_IncrementalCC_Insert (cc, I, J, ne, msg)) ;
+        OK (LAGraph_IncrementalCC_Insert (cc, I, I, ne, msg)) ;
+        build_graph (n, ne) ;
+        check_components (n) ;
+        OK (LAGraph_IncrementalCC_Delete (&cc, msg)) ;
+        TEST_CHECK (cc == NULL) ;
+
+        // start with no edges, and insert all of them in a single batch
+        OK (GrB_Matrix_new (&A, GrB_BOOL, n, n)) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGraph_IncrementalCC_New (&cc, G, msg)) ;
+        OK (LAGraph_IncrementalCC_Insert (cc, I, J, ne, msg)) ;
+        check_components (n) ;
+        OK (LAGraph_IncrementalCC_Delete (&cc, msg)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+        OK (LAGraph_Delete (&Gk, msg)) ;
+
+        OK (LAGraph_Free ((void **) &I, msg)) ;
+        OK (LAGraph_Free ((void **) &J, msg)) ;
+        OK (LAGraph_Free ((void **) &X, msg)) ;
+        OK (LAGraph_Free ((void **) &W, msg)) ;
+        OK (LAGraph_Free ((void **) &Cx, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+void test_IncrementalCC_hub (void)
+{
+    LAGraph_Init (msg) ;
+
+    // a batch of edges (n-1,i) for all i < n-1: the hub n-1 is the largest
+    // root of every edge, so all the edges try to hook it in the first round
+    GrB_Index n = 2001, ne = n-1 ;
+    OK (LAGraph_Malloc ((void **) &I, ne, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &J, ne, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &X, ne, sizeof (bool), msg)) ;
+    OK (LAGraph_Malloc ((void **) &W, n, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &Cx, n, sizeof (int64_t), msg)) ;
+    for (int64_t e = 0 ; e < ne ; e++)
+    {
+        I [e] = n-1 ;
+        J [e] = e ;
+        X [e] = true ;
+    }
+
+    OK (GrB_Matrix_new (&A, GrB_BOOL, n, n)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    OK (LAGraph_IncrementalCC_New (&cc, G, msg)) ;
+    OK (LAGraph_IncrementalCC_Insert (cc, I, J, ne, msg)) ;
+
+    // the hub is hooked onto node 0, and then all other nodes onto node 0
+    printf ("\nhub: rounds %g\n", (double) cc->nrounds) ;
+    TEST_CHECK (cc->nrounds <= 2) ;
+    build_graph (n, ne) ;
+    check_components (n) ;
+
+    OK (LAGraph_IncrementalCC_Delete (&cc, msg)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Delete (&Gk, msg)) ;
+    OK (LAGraph_Free ((void **) &I, msg)) ;
+    OK (LAGraph_Free ((void **) &J, msg)) ;
+    OK (LAGraph_Free ((void **) &X, msg)) ;
+    OK (LAGraph_Free ((void **) &W, msg)) ;
+    OK (LAGraph_Free ((void **) &Cx, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+void test_IncrementalCC_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+    // G->A must be known to be symmetric
+    int result = LAGraph_IncrementalCC_New (&cc, G, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED) ;
+    TEST_CHECK (cc == NULL) ;
+
+    // null pointers
+    result = LAGraph_IncrementalCC_New (NULL, G, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_IncrementalCC_New (&cc, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    TEST_CHECK (cc == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // an empty graph
+    OK (GrB_Matrix_new (&A, GrB_BOOL, n, n)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    OK (LAGraph_IncrementalCC_New (&cc, G, msg)) ;
+
+    GrB_Index Ibad [2] = { 0, 1 } ;
+    GrB_Index Jbad [2] = { 2, n } ;
+    result = LAGraph_IncrementalCC_Insert (cc, Ibad, Jbad, 2, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INDEX_OUT_OF_BOUNDS) ;
+    result = LAGraph_IncrementalCC_Insert (cc, NULL, Jbad, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_IncrementalCC_Insert (NULL, Ibad, Jbad, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_IncrementalCC_Component (NULL, cc, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_IncrementalCC_Component (&C, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    TEST_CHECK (C == NULL) ;
+
+    // an empty batch is OK
+    OK (LAGraph_IncrementalCC_Insert (cc, NULL, NULL, 0, msg)) ;
+
+    OK (LAGraph_IncrementalCC_Delete (&cc, msg)) ;
+    OK (LAGraph_IncrementalCC_Delete (&cc, msg)) ;
+    OK (LAGraph_IncrementalCC_Delete (NULL, msg)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"IncrementalCC", test_IncrementalCC},
+    {"IncrementalCC_hub", test_IncrementalCC_hub},
+    {"IncrementalCC_errors", test_IncrementalCC_errors},
+    {NULL, NULL}
+};
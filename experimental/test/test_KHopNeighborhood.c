@@ -0,0 +1,211 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_KHopNeighborhood.c: test LAGraph_KHopNeighborhood
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL, S = NULL ;
+GrB_Vector level = NULL, level2 = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "A.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGRAPH_UNKNOWN,              ""
+} ;
+
+//****************************************************************************
+
+void test_KHopNeighborhood (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int kk = 0 ; ; kk++)
+    {
+
+        // load the graph
+        const char *aname = files [kk].name ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", kk, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (LAGraph_New (&G, &A, files [kk].kind, msg)) ;
+        GrB_Index n, nvals ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+
+        // a batch of seeds, with a duplicate
+        GrB_Index seeds [4] = { 0, n/2, 0, n-1 } ;
+        int64_t nseeds = 4 ;
+
+        // get the levels from each seed with a full BFS
+        int64_t *Level = NULL ;
+        OK (LAGraph_Malloc ((void **) &Level, n, sizeof (int64_t), msg)) ;
+        for (int64_t i = 0 ; i < n ; i++) Level [i] = INT64_MAX ;
+        for (int64_t s = 0 ; s < nseeds ; s++)
+        {
+            OK (LAGr_BreadthFirstSearch (&level2, NULL, G, seeds [s], msg)) ;
+            for (int64_t i = 0 ; i < n ; i++)
+            {
+                int64_t x ;
+                int info = GrB_Vector_extractElement_INT64 (&x, level2, i) ;
+                if (info == GrB_SUCCESS) Level [i] = LAGRAPH_MIN (Level [i], x);
+            }
+            OK (GrB_free (&level2)) ;
+        }
+
+        // get the edges of the graph
+        GrB_Index *I = NULL, *J = NULL ;
+        OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+        OK (GrB_Matrix_extractTuples_INT64 (I, J, NULL, &nvals, G->A)) ;
+
+        for (int64_t k = 0 ; k <= 4 ; k++)
+        {
+            OK (LAGraph_KHopNeighborhood (&level, &S, G, seeds, nseeds, k,
+                msg)) ;
+
+            // check the level vector
+            GrB_Index m ;
+            OK (GrB_Vector_nvals (&m, level)) ;
+            int64_t m2 = 0 ;
+            for (int64_t i = 0 ; i < n ; i++)
+            {
+                int64_t x = -1 ;
+                int info = GrB_Vector_extractElement_INT64 (&x, level, i) ;
+                TEST_CHECK (info == GrB_SUCCESS || info == GrB_NO_VALUE) ;
+                if (Level [i] <= k)
+                {
+                    TEST_CHECK (x == Level [i]) ;
+                    m2++ ;
+                }
+                else
+                {
+                    TEST_CHECK (info == GrB_NO_VALUE) ;
+                }
+            }
+            TEST_CHECK (m == m2) ;
+
+            // check the induced subgraph
+            GrB_Index snrows, sncols, snvals ;
+            OK (GrB_Matrix_nrows (&snrows, S)) ;
+            OK (GrB_Matrix_ncols (&sncols, S)) ;
+            OK (GrB_Matrix_nvals (&snvals, S)) ;
+            TEST_CHECK (snrows == m && sncols == m) ;
+            int64_t nedges = 0 ;
+            for (int64_t e = 0 ; e < nvals ; e++)
+            {
+                nedges += (Level [I [e]] <= k && Level [J [e]] <= k) ;
+            }
+            TEST_CHECK (snvals == nedges) ;
+            printf ("k: %g nodes: %g edges: %g\n", (double) k, (double) m,
+                (double) nedges) ;
+            OK (GrB_free (&level)) ;
+            OK (GrB_free (&S)) ;
+
+            // level only
+            OK (LAGraph_KHopNeighborhood (&level, NULL, G, seeds, nseeds, k,
+                msg)) ;
+            OK (GrB_Vector_nvals (&m, level)) ;
+            TEST_CHECK (m == m2) ;
+            OK (GrB_free (&level)) ;
+        }
+
+        LAGraph_Free ((void **) &Level, NULL) ;
+        LAGraph_Free ((void **) &I, NULL) ;
+        LAGraph_Free ((void **) &J, NULL) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+void test_KHopNeighborhood_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    GrB_Index seeds [2] = { 0, 34 } ;
+
+    // level is NULL
+    int result = LAGraph_KHopNeighborhood (NULL, &S, G, seeds, 1, 2, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    TEST_CHECK (S == NULL) ;
+
+    // k is negative
+    result = LAGraph_KHopNeighborhood (&level, &S, G, seeds, 1, -1, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (level == NULL) ;
+
+    // invalid seed
+    result = LAGraph_KHopNeighborhood (&level, &S, G, seeds, 2, 2, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (level == NULL && S == NULL) ;
+
+    // no seeds: the neighborhood is empty
+    OK (LAGraph_KHopNeighborhood (&level, &S, G, NULL, 0, 2, msg)) ;
+    GrB_Index m ;
+    OK (GrB_Vector_nvals (&m, level)) ;
+    TEST_CHECK (m == 0) ;
+    OK (GrB_Matrix_nrows (&m, S)) ;
+    TEST_CHECK (m == 0) ;
+    OK (GrB_free (&level)) ;
+    OK (GrB_free (&S)) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"KHopNeighborhood", test_KHopNeighborhood},
+    {"KHopNeighborhood_errors", test_KHopNeighborhood_errors},
+    {NULL, NULL}
+};
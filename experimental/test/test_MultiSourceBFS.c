@@ -0,0 +1,191 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_MultiSourceBFS.c: test LAGraph_MultiSourceBFS
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL, Level = NULL, Parent = NULL ;
+GrB_Vector level = NULL, parent = NULL, level2 = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "ldbc-undirected-example.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "A.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGRAPH_UNKNOWN,              ""
+} ;
+
+//------------------------------------------------------------------------------
+// check_row: check the BFS from sources [i] against LAGr_BreadthFirstSearch
+//------------------------------------------------------------------------------
+
+static void check_row (GrB_Matrix L, GrB_Matrix P, int64_t i, GrB_Index src,
+    GrB_Index n)
+{
+    bool ok = false ;
+    if (L != NULL)
+    {
+        // level = L (i,:)'
+        OK (GrB_Vector_new (&level, GrB_INT32, n)) ;
+        OK (GrB_Col_extract (level, NULL, NULL, L, GrB_ALL, n, i,
+            GrB_DESC_T0)) ;
+        OK (LAGr_BreadthFirstSearch (&level2, NULL, G, src, msg)) ;
+        OK (LAGraph_Vector_IsEqual (&ok, level, level2, msg)) ;
+        TEST_CHECK (ok) ;
+        TEST_MSG ("level wrong for source %g", (double) src) ;
+        OK (GrB_free (&level2)) ;
+    }
+    if (P != NULL)
+    {
+        // parent = P (i,:)'
+        OK (GrB_Vector_new (&parent, GrB_INT64, n)) ;
+        OK (GrB_Col_extract (parent, NULL, NULL, P, GrB_ALL, n, i,
+            GrB_DESC_T0)) ;
+    }
+    // the parent is not unique, so it is checked with LG_check_bfs
+    OK (LG_check_bfs (level, parent, G, src, msg)) ;
+    OK (GrB_free (&level)) ;
+    OK (GrB_free (&parent)) ;
+}
+
+//****************************************************************************
+
+void test_MultiSourceBFS (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the graph
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        // a batch of sources, with a duplicate
+        GrB_Index sources [5] = { 0, n-1, n/2, 0, n/3 } ;
+        int64_t ns = 5 ;
+
+        for (int cached = 0 ; cached <= 1 ; cached++)
+        {
+            if (cached)
+            {
+                // with G->AT and G->out_degree: push/pull
+                OK (LAGraph_Cached_AT (G, msg)) ;
+                OK (LAGraph_Cached_OutDegree (G, msg)) ;
+            }
+
+            for (int what = 0 ; what <= 2 ; what++)
+            {
+                // what = 0: level and parent, 1: level only, 2: parent only
+                GrB_Matrix *Lhandle = (what == 2) ? NULL : &Level ;
+                GrB_Matrix *Phandle = (what == 1) ? NULL : &Parent ;
+                OK (LAGraph_MultiSourceBFS (Lhandle, Phandle, G, sources, ns,
+                    msg)) ;
+                GrB_Index nrows, ncols ;
+                GrB_Matrix M = (what == 2) ? Parent : Level ;
+                OK (GrB_Matrix_nrows (&nrows, M)) ;
+                OK (GrB_Matrix_ncols (&ncols, M)) ;
+                TEST_CHECK (nrows == ns && ncols == n) ;
+                for (int64_t i = 0 ; i < ns ; i++)
+                {
+                    check_row (Level, Parent, i, sources [i], n) ;
+                }
+                OK (GrB_free (&Level)) ;
+                OK (GrB_free (&Parent)) ;
+            }
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+void test_MultiSourceBFS_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    GrB_Index sources [2] = { 0, 1 } ;
+
+    // level and parent both NULL
+    int result = LAGraph_MultiSourceBFS (NULL, NULL, G, sources, 2, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // sources NULL
+    result = LAGraph_MultiSourceBFS (&Level, NULL, G, NULL, 2, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    TEST_CHECK (Level == NULL) ;
+
+    // no sources
+    result = LAGraph_MultiSourceBFS (&Level, &Parent, G, sources, 0, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // invalid source
+    sources [1] = 34 ;
+    result = LAGraph_MultiSourceBFS (&Level, &Parent, G, sources, 2, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (Level == NULL && Parent == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"MultiSourceBFS", test_MultiSourceBFS},
+    {"MultiSourceBFS_errors", test_MultiSourceBFS_errors},
+    {NULL, NULL}
+};
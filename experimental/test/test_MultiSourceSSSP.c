@@ -0,0 +1,195 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_MultiSourceSSSP.c: test LAGraph_MultiSourceSSSP
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL, T = NULL, D = NULL ;
+GrB_Vector path_length = NULL ;
+GrB_Scalar Delta = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "karate.mtx",
+    "west0067.mtx",
+    "cover.mtx",
+    "ldbc-directed-example.mtx",
+    "A.mtx",
+    "jagmesh7.mtx",
+    "bcsstk13.mtx",
+    ""
+} ;
+
+//****************************************************************************
+
+void test_MultiSourceSSSP (void)
+{
+    LAGraph_Init (msg) ;
+    OK (GrB_Scalar_new (&Delta, GrB_FP64)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the matrix
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&T, f, msg)) ;
+        fclose (f) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, T)) ;
+
+        // a batch of sources, with a duplicate
+        GrB_Index sources [5] = { 0, n-1, n/2, 0, n/3 } ;
+        int64_t ns = 5 ;
+
+        for (int kind = 0 ; kind <= 1 ; kind++)
+        {
+
+            //------------------------------------------------------------------
+            // construct a graph with positive weights, of type int32 or double
+            //------------------------------------------------------------------
+
+            if (kind == 0)
+            {
+                // A = min (max (abs (int32 (T)), 1), 255)
+                OK (GrB_Matrix_new (&A, GrB_INT32, n, n)) ;
+                OK (GrB_apply (A, NULL, NULL, GrB_ABS_INT32, T, NULL)) ;
+                OK (GrB_apply (A, NULL, NULL, GrB_MAX_INT32, A, 1, NULL)) ;
+                OK (GrB_apply (A, NULL, NULL, GrB_MIN_INT32, A, 255, NULL)) ;
+            }
+            else
+            {
+                // A = max (abs (double (T)), 0.5)
+                OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+                OK (GrB_apply (A, NULL, NULL, GrB_ABS_FP64, T, NULL)) ;
+                OK (GrB_apply (A, NULL, NULL, GrB_MAX_FP64, A, 0.5, NULL)) ;
+            }
+            OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+            OK (LAGraph_Cached_EMin (G, msg)) ;
+
+            //------------------------------------------------------------------
+            // check each row against the single-source result
+            //------------------------------------------------------------------
+
+            double Deltas [3] = { 1, 30, 1e6 } ;
+            for (int kk = 0 ; kk < 3 ; kk++)
+            {
+                OK (GrB_Scalar_setElement (Delta, Deltas [kk])) ;
+                OK (LAGraph_MultiSourceSSSP (&D, G, sources, ns, Delta, msg)) ;
+                GrB_Index nrows, ncols, nvals ;
+                OK (GrB_Matrix_nrows (&nrows, D)) ;
+                OK (GrB_Matrix_ncols (&ncols, D)) ;
+                OK (GrB_Matrix_nvals (&nvals, D)) ;
+                TEST_CHECK (nrows == ns && ncols == n && nvals == ns * n) ;
+                for (int64_t i = 0 ; i < ns ; i++)
+                {
+                    // path_length = D (i,:)'
+                    OK (GrB_Vector_new (&path_length,
+                        (kind == 0) ? GrB_INT32 : GrB_FP64, n)) ;
+                    OK (GrB_Col_extract (path_length, NULL, NULL, D, GrB_ALL,
+                        n, i, GrB_DESC_T0)) ;
+                    int res = LG_check_sssp (path_length, G, sources [i], msg) ;
+                    if (res != GrB_SUCCESS) printf ("res %d %s\n", res, msg) ;
+                    OK (res) ;
+                    OK (GrB_free (&path_length)) ;
+                }
+                OK (GrB_free (&D)) ;
+            }
+            OK (LAGraph_Delete (&G, msg)) ;
+        }
+        OK (GrB_free (&T)) ;
+    }
+
+    OK (GrB_free (&Delta)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+void test_MultiSourceSSSP_errors (void)
+{
+    LAGraph_Init (msg) ;
+    OK (GrB_Scalar_new (&Delta, GrB_FP64)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    GrB_Index sources [2] = { 0, 34 } ;
+
+    // Delta is empty
+    int result = LAGraph_MultiSourceSSSP (&D, G, sources, 1, Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_EMPTY_OBJECT) ;
+    TEST_CHECK (D == NULL) ;
+
+    // Delta must be > 0
+    double bad_deltas [2] = { 0, -1 } ;
+    for (int k = 0 ; k < 2 ; k++)
+    {
+        OK (GrB_Scalar_setElement (Delta, bad_deltas [k])) ;
+        result = LAGraph_MultiSourceSSSP (&D, G, sources, 1, Delta, msg) ;
+        printf ("result: %d %s\n", result, msg) ;
+        TEST_CHECK (result == GrB_INVALID_VALUE) ;
+        TEST_CHECK (D == NULL) ;
+    }
+    OK (GrB_Scalar_setElement (Delta, 2)) ;
+
+    // karate is boolean, which is not supported
+    result = LAGraph_MultiSourceSSSP (&D, G, sources, 1, Delta, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
+
+    // invalid source
+    result = LAGraph_MultiSourceSSSP (&D, G, sources, 2, Delta, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+
+    // no sources
+    result = LAGraph_MultiSourceSSSP (&D, G, sources, 0, Delta, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_MultiSourceSSSP (&D, G, NULL, 1, Delta, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_MultiSourceSSSP (NULL, G, sources, 1, Delta, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (GrB_free (&Delta)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"MultiSourceSSSP", test_MultiSourceSSSP},
+    {"MultiSourceSSSP_errors", test_MultiSourceSSSP_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,199 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_PageRankIncremental.c: test warm-started PR
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+#include <LG_Xtest.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL, G2 = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector r = NULL, r2 = NULL, rnew = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+//****************************************************************************
+
+void test_PageRankIncremental (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the graph
+        LAGraph_Kind kind ;
+        const char *aname = LG_check_pagerank_graph (&kind, k) ;
+        if (aname == NULL) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (LAGraph_New (&G, &A, kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        int iters = 0, iters2 = 0 ;
+        double err ;
+
+        //----------------------------------------------------------------------
+        // a cold start is the same as LAGr_PageRank
+        //----------------------------------------------------------------------
+
+        OK (LAGr_PageRank (&r, &iters, G, 0.85, 1e-5, 100, msg)) ;
+        for (int push = 0 ; push <= 1 ; push++)
+        {
+            OK (LAGraph_PageRankIncremental (&r2, &iters2, NULL, G, NULL,
+                push, 0.85, 1e-5, 100, msg)) ;
+            OK (LG_check_pagerank_diff (&err, r, r2, msg)) ;
+            printf ("cold, push %d: err %e iters %d %d\n", push, err, iters,
+                iters2) ;
+            TEST_CHECK (err < 1e-4) ;
+            OK (GrB_free (&r2)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // add a few edges, and warm start from the old PageRank
+        //----------------------------------------------------------------------
+
+        OK (GrB_Matrix_dup (&A, G->A)) ;
+        GrB_Index I [2] = { 0, 1 } ;
+        GrB_Index J [2] = { n-1, n/2 } ;
+        for (int e = 0 ; e < 2 ; e++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A, 1, I [e], J [e])) ;
+            OK (GrB_Matrix_setElement_FP64 (A, 1, J [e], I [e])) ;
+        }
+        OK (LAGraph_New (&G2, &A, kind, msg)) ;
+        OK (LAGraph_Cached_AT (G2, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G2, msg)) ;
+        OK (LAGr_PageRank (&rnew, &iters, G2, 0.85, 1e-5, 100, msg)) ;
+
+        // the work of a full recompute
+        GrB_Index nedges_cold, nedges, nsinks ;
+        OK (GrB_Vector_nvals (&nsinks, G2->out_degree)) ;
+        nsinks = n - nsinks ;
+        OK (LAGraph_PageRankIncremental (&r2, &iters2, &nedges_cold, G2, NULL,
+            false, 0.85, 1e-5, 100, msg)) ;
+        OK (GrB_free (&r2)) ;
+
+        for (int push = 0 ; push <= 1 ; push++)
+        {
+            OK (LAGraph_PageRankIncremental (&r2, &iters2, &nedges, G2, r,
+                push, 0.85, 1e-5, 100, msg)) ;
+            OK (LG_check_pagerank_diff (&err, rnew, r2, msg)) ;
+            printf ("warm, push %d: err %e iters %d %d, edges %g (cold %g)\n",
+                push, err, iters, iters2, (double) nedges,
+                (double) nedges_cold) ;
+            TEST_CHECK (err < 1e-4) ;
+            // the warm start takes fewer iterations than a cold start
+            if (!push) TEST_CHECK (iters2 <= iters) ;
+            // the push touches fewer edges than a full recompute, unless sinks
+            // spread their residual over all the nodes
+            if (push && nsinks == 0) TEST_CHECK (nedges < nedges_cold) ;
+            OK (GrB_free (&r2)) ;
+        }
+
+        OK (GrB_free (&r)) ;
+        OK (GrB_free (&rnew)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+        OK (LAGraph_Delete (&G2, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+void test_PageRankIncremental_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+    int iters = 0 ;
+
+    // G->AT is missing
+    int result = LAGraph_PageRankIncremental (&r, &iters, NULL, G, NULL, true,
+        0.85, 1e-4, 100, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (r == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+
+    // G->out_degree is missing
+    result = LAGraph_PageRankIncremental (&r, &iters, NULL, G, NULL, true,
+        0.85, 1e-4, 100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    // r0 is empty
+    OK (GrB_Vector_new (&r2, GrB_FP64, n)) ;
+    result = LAGraph_PageRankIncremental (&r, &iters, NULL, G, r2, false,
+        0.85, 1e-4, 100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    OK (GrB_free (&r2)) ;
+
+    // r0 has the wrong size
+    OK (GrB_Vector_new (&r2, GrB_FP32, n+1)) ;
+    OK (GrB_Vector_setElement (r2, 1, 0)) ;
+    result = LAGraph_PageRankIncremental (&r, &iters, NULL, G, r2, false,
+        0.85, 1e-4, 100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+    OK (GrB_free (&r2)) ;
+
+    // failure to converge
+    for (int push = 0 ; push <= 1 ; push++)
+    {
+        result = LAGraph_PageRankIncremental (&r, &iters, NULL, G, NULL, push,
+            0.85, 1e-4, 2, msg) ;
+        printf ("result: %d %s\n", result, msg) ;
+        TEST_CHECK (result == LAGRAPH_CONVERGENCE_FAILURE) ;
+        TEST_CHECK (r == NULL) ;
+    }
+
+    result = LAGraph_PageRankIncremental (NULL, &iters, NULL, G, NULL, true,
+        0.85, 1e-4, 100, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"PageRankIncremental", test_PageRankIncremental},
+    {"PageRankIncremental_errors", test_PageRankIncremental_errors},
+    {NULL, NULL}
+};
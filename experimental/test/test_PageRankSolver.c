@@ -0,0 +1,159 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_PageRankSolver.c: test LAGraph_PageRankSolver
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+#include <LG_Xtest.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector r = NULL, r2 = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+// GaussSeidel and Extrapolated must take fewer iterations than Jacobi for
+// these graphs
+static bool faster (const char *name)
+{
+    return (strcmp (name, "cover.mtx") == 0 ||
+            strcmp (name, "bcsstk13.mtx") == 0) ;
+}
+
+const char *method_name [3] = { "Jacobi", "GaussSeidel", "Extrapolated" } ;
+
+//****************************************************************************
+
+void test_PageRankSolver (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the graph
+        LAGraph_Kind kind ;
+        const char *aname = LG_check_pagerank_graph (&kind, k) ;
+        if (aname == NULL) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (LAGraph_New (&G, &A, kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        int iters = 0, iters2 = 0 ;
+
+        // compare each method with LAGr_PageRank
+        OK (LAGr_PageRank (&r, &iters, G, 0.85, 1e-5, 200, msg)) ;
+        for (int method = 0 ; method <= 2 ; method++)
+        {
+            OK (LAGraph_PageRankSolver (&r2, &iters2, G, method, 0.85, 1e-5,
+                200, msg)) ;
+            double err ;
+            OK (LG_check_pagerank_diff (&err, r, r2, msg)) ;
+            float rsum = 0 ;
+            OK (GrB_reduce (&rsum, NULL, GrB_PLUS_MONOID_FP32, r2, NULL)) ;
+            printf ("%-12s: err %e sum %g iters %d (power method: %d)\n",
+                method_name [method], err, rsum, iters2, iters) ;
+            TEST_CHECK (err < 1e-4) ;
+            TEST_CHECK (fabs (rsum - 1) < 1e-3) ;
+            if (method == LAGraph_PageRank_Jacobi)
+            {
+                TEST_CHECK (iters == iters2) ;
+            }
+            else if (faster (aname))
+            {
+                TEST_CHECK (iters2 < iters) ;
+                TEST_MSG ("%s took %d iterations, power method: %d",
+                    method_name [method], iters2, iters) ;
+            }
+            OK (GrB_free (&r2)) ;
+        }
+
+        OK (GrB_free (&r)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+void test_PageRankSolver_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    int iters = 0 ;
+
+    // G->AT is missing
+    int result = LAGraph_PageRankSolver (&r, &iters, G,
+        LAGraph_PageRank_GaussSeidel, 0.85, 1e-4, 100, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (r == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+
+    // G->out_degree is missing
+    result = LAGraph_PageRankSolver (&r, &iters, G,
+        LAGraph_PageRank_GaussSeidel, 0.85, 1e-4, 100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    // invalid method
+    result = LAGraph_PageRankSolver (&r, &iters, G, 99, 0.85, 1e-4, 100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // failure to converge
+    for (int method = 0 ; method <= 2 ; method++)
+    {
+        result = LAGraph_PageRankSolver (&r, &iters, G, method, 0.85, 1e-4,
+            2, msg) ;
+        printf ("result: %d %s\n", result, msg) ;
+        TEST_CHECK (result == LAGRAPH_CONVERGENCE_FAILURE) ;
+        TEST_CHECK (r == NULL) ;
+    }
+
+    result = LAGraph_PageRankSolver (NULL, &iters, G,
+        LAGraph_PageRank_Jacobi, 0.85, 1e-4, 100, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"PageRankSolver", test_PageRankSolver},
+    {"PageRankSolver_errors", test_PageRankSolver_errors},
+    {NULL, NULL}
+};
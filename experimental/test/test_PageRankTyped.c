@@ -0,0 +1,176 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_PageRankTyped.c: test LAGraph_PageRankTyped
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+#include <LG_Xtest.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector r = NULL, r2 = NULL, r3 = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+//****************************************************************************
+
+void test_PageRankTyped (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the graph
+        LAGraph_Kind kind ;
+        const char *aname = LG_check_pagerank_graph (&kind, k) ;
+        if (aname == NULL) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (LAGraph_New (&G, &A, kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        int iters = 0, iters2 = 0 ;
+        double err ;
+        char type_name [LAGRAPH_MAX_NAME_LEN] ;
+
+        //----------------------------------------------------------------------
+        // FP32 is the same as LAGr_PageRank and LAGr_PageRankGAP
+        //----------------------------------------------------------------------
+
+        OK (LAGr_PageRank (&r, &iters, G, 0.85, 1e-4, 100, msg)) ;
+        OK (LAGraph_PageRankTyped (&r2, &iters2, G, LAGraph_PageRank_FP32,
+            false, 0.85, 1e-4, 100, msg)) ;
+        OK (LG_check_pagerank_diff (&err, r, r2, msg)) ;
+        printf ("fp32: err %e iters %d %d\n", err, iters, iters2) ;
+        TEST_CHECK (err < 1e-6) ;
+        OK (GrB_free (&r)) ;
+        OK (GrB_free (&r2)) ;
+
+        OK (LAGr_PageRankGAP (&r, &iters, G, 0.85, 1e-4, 100, msg)) ;
+        OK (LAGraph_PageRankTyped (&r2, &iters2, G, LAGraph_PageRank_FP32,
+            true, 0.85, 1e-4, 100, msg)) ;
+        OK (LG_check_pagerank_diff (&err, r, r2, msg)) ;
+        printf ("gap:  err %e iters %d %d\n", err, iters, iters2) ;
+        TEST_CHECK (err < 1e-6) ;
+        OK (GrB_free (&r)) ;
+        OK (GrB_free (&r2)) ;
+
+        //----------------------------------------------------------------------
+        // FP64 with a tight tolerance, compared with FP32 and mixed
+        //----------------------------------------------------------------------
+
+        OK (LAGraph_PageRankTyped (&r, &iters, G, LAGraph_PageRank_FP64,
+            false, 0.85, 1e-12, 500, msg)) ;
+        OK (LAGraph_Vector_TypeName (type_name, r, msg)) ;
+        OK (strcmp (type_name, "double")) ;
+        double rsum = 0 ;
+        OK (GrB_reduce (&rsum, NULL, GrB_PLUS_MONOID_FP64, r, NULL)) ;
+        printf ("fp64: iters %d sum %.15g\n", iters, rsum) ;
+        TEST_CHECK (fabs (rsum - 1) < 1e-10) ;
+
+        OK (LAGraph_PageRankTyped (&r2, &iters2, G, LAGraph_PageRank_FP32,
+            false, 0.85, 1e-5, 100, msg)) ;
+        OK (LAGraph_PageRankTyped (&r3, &iters2, G, LAGraph_PageRank_Mixed,
+            false, 0.85, 1e-5, 100, msg)) ;
+        OK (LAGraph_Vector_TypeName (type_name, r3, msg)) ;
+        OK (strcmp (type_name, "float")) ;
+        double err32, errmixed ;
+        OK (LG_check_pagerank_diff (&err32, r, r2, msg)) ;
+        OK (LG_check_pagerank_diff (&errmixed, r, r3, msg)) ;
+        printf ("fp32 err %e, mixed err %e\n", err32, errmixed) ;
+        TEST_CHECK (err32 < 1e-4) ;
+        TEST_CHECK (errmixed < 1e-4) ;
+
+        OK (GrB_free (&r)) ;
+        OK (GrB_free (&r2)) ;
+        OK (GrB_free (&r3)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+void test_PageRankTyped_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    int iters = 0 ;
+
+    // G->AT is missing
+    int result = LAGraph_PageRankTyped (&r, &iters, G, LAGraph_PageRank_FP64,
+        false, 0.85, 1e-4, 100, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (r == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+
+    // G->out_degree is missing
+    result = LAGraph_PageRankTyped (&r, &iters, G, LAGraph_PageRank_FP64,
+        false, 0.85, 1e-4, 100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    // invalid precision
+    result = LAGraph_PageRankTyped (&r, &iters, G, 99,
+        false, 0.85, 1e-4, 100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // failure to converge, except for the GAP method
+    result = LAGraph_PageRankTyped (&r, &iters, G, LAGraph_PageRank_Mixed,
+        false, 0.85, 1e-4, 2, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_CONVERGENCE_FAILURE) ;
+    TEST_CHECK (r == NULL) ;
+    OK (LAGraph_PageRankTyped (&r, &iters, G, LAGraph_PageRank_Mixed,
+        true, 0.85, 1e-4, 2, msg)) ;
+    TEST_CHECK (iters == 2) ;
+    OK (GrB_free (&r)) ;
+
+    result = LAGraph_PageRankTyped (NULL, &iters, G, LAGraph_PageRank_FP32,
+        false, 0.85, 1e-4, 100, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"PageRankTyped", test_PageRankTyped},
+    {"PageRankTyped_errors", test_PageRankTyped_errors},
+    {NULL, NULL}
+};
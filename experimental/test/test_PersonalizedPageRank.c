@@ -0,0 +1,202 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_PersonalizedPageRank.c: test personalized PR
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+#include <LG_Xtest.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL, P = NULL, R = NULL ;
+GrB_Vector p = NULL, r = NULL, r2 = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+//****************************************************************************
+
+void test_PersonalizedPageRank (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the graph
+        LAGraph_Kind kind ;
+        const char *aname = LG_check_pagerank_graph (&kind, k) ;
+        if (aname == NULL) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (LAGraph_New (&G, &A, kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        int iters = 0, iters2 = 0 ;
+        double err ;
+        float rsum ;
+
+        //----------------------------------------------------------------------
+        // a uniform personalization is the same as LAGr_PageRank
+        //----------------------------------------------------------------------
+
+        OK (GrB_Vector_new (&p, GrB_FP32, n)) ;
+        OK (GrB_assign (p, NULL, NULL, (float) 3, GrB_ALL, n, NULL)) ;
+        OK (LAGraph_PersonalizedPageRank (&r, &iters, G, p, 0.85, 1e-5, 100,
+            msg)) ;
+        OK (LAGr_PageRank (&r2, &iters2, G, 0.85, 1e-5, 100, msg)) ;
+        OK (LG_check_pagerank_diff (&err, r, r2, msg)) ;
+        printf ("uniform: err %e iters %d %d\n", err, iters, iters2) ;
+        TEST_CHECK (err < 1e-4) ;
+        OK (GrB_free (&p)) ;
+        OK (GrB_free (&r)) ;
+        OK (GrB_free (&r2)) ;
+
+        //----------------------------------------------------------------------
+        // a batch of sparse personalizations
+        //----------------------------------------------------------------------
+
+        // column 0: node 0; column 1: nodes 0 and n-1; column 2: node n/2
+        GrB_Index I [4] = { 0, 0, n-1, n/2 } ;
+        GrB_Index J [4] = { 0, 1, 1,   2   } ;
+        double    X [4] = { 1, 2, 2,   5   } ;
+        int64_t nbatch = 3 ;
+        OK (GrB_Matrix_new (&P, GrB_FP64, n, nbatch)) ;
+        OK (GrB_Matrix_build (P, I, J, X, 4, GrB_PLUS_FP64)) ;
+        OK (LAGraph_PersonalizedPageRank_Batch (&R, &iters, G, P, 0.85, 1e-5,
+            100, msg)) ;
+        GrB_Index nrows, ncols ;
+        OK (GrB_Matrix_nrows (&nrows, R)) ;
+        OK (GrB_Matrix_ncols (&ncols, R)) ;
+        TEST_CHECK (nrows == n && ncols == nbatch) ;
+
+        for (int64_t j = 0 ; j < nbatch ; j++)
+        {
+            // r = R (:,j) must sum to one
+            OK (GrB_Vector_new (&r, GrB_FP32, n)) ;
+            OK (GrB_Col_extract (r, NULL, NULL, R, GrB_ALL, n, j, NULL)) ;
+            OK (GrB_reduce (&rsum, NULL, GrB_PLUS_MONOID_FP32, r, NULL)) ;
+            TEST_CHECK (fabs (rsum - 1) < 1e-4) ;
+
+            // compare with a single personalized PageRank
+            OK (GrB_Vector_new (&p, GrB_FP64, n)) ;
+            OK (GrB_Col_extract (p, NULL, NULL, P, GrB_ALL, n, j, NULL)) ;
+            OK (LAGraph_PersonalizedPageRank (&r2, &iters2, G, p, 0.85, 1e-5,
+                100, msg)) ;
+            OK (LG_check_pagerank_diff (&err, r, r2, msg)) ;
+            printf ("batch %d: err %e sum %g iters %d %d\n", (int) j, err,
+                rsum, iters, iters2) ;
+            TEST_CHECK (err < 1e-4) ;
+            TEST_CHECK (iters2 <= iters) ;
+            OK (GrB_free (&p)) ;
+            OK (GrB_free (&r)) ;
+            OK (GrB_free (&r2)) ;
+        }
+        OK (GrB_free (&P)) ;
+        OK (GrB_free (&R)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+void test_PersonalizedPageRank_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+    int iters = 0 ;
+
+    // G->AT is missing
+    OK (GrB_Vector_new (&p, GrB_FP32, n)) ;
+    OK (GrB_Vector_setElement (p, 1, 0)) ;
+    int result = LAGraph_PersonalizedPageRank (&r, &iters, G, p, 0.85, 1e-4,
+        100, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (r == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+
+    // G->out_degree is missing
+    result = LAGraph_PersonalizedPageRank (&r, &iters, G, p, 0.85, 1e-4,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    // p has a negative entry
+    OK (GrB_Vector_setElement (p, -1, 1)) ;
+    result = LAGraph_PersonalizedPageRank (&r, &iters, G, p, 0.85, 1e-4,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // p is empty
+    OK (GrB_Vector_clear (p)) ;
+    result = LAGraph_PersonalizedPageRank (&r, &iters, G, p, 0.85, 1e-4,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    OK (GrB_free (&p)) ;
+
+    // p has the wrong size
+    OK (GrB_Vector_new (&p, GrB_FP32, n+1)) ;
+    OK (GrB_Vector_setElement (p, 1, 0)) ;
+    result = LAGraph_PersonalizedPageRank (&r, &iters, G, p, 0.85, 1e-4,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+    OK (GrB_free (&p)) ;
+
+    // failure to converge
+    OK (GrB_Vector_new (&p, GrB_FP32, n)) ;
+    OK (GrB_Vector_setElement (p, 1, 0)) ;
+    result = LAGraph_PersonalizedPageRank (&r, &iters, G, p, 0.85, 1e-4,
+        2, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_CONVERGENCE_FAILURE) ;
+    TEST_CHECK (r == NULL) ;
+    OK (GrB_free (&p)) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"PersonalizedPageRank", test_PersonalizedPageRank},
+    {"PersonalizedPageRank_errors", test_PersonalizedPageRank_errors},
+    {NULL, NULL}
+};
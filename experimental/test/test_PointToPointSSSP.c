@@ -0,0 +1,236 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_PointToPointSSSP.c: test LAGraph_PointToPointSSSP
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL, T = NULL ;
+GrB_Vector path_length = NULL, dland = NULL, h = NULL ;
+GrB_Scalar Delta = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "karate.mtx",
+    "west0067.mtx",
+    "cover.mtx",
+    "ldbc-directed-example.mtx",
+    "A.mtx",
+    "jagmesh7.mtx",
+    "bcsstk13.mtx",
+    ""
+} ;
+
+// get x = v (i) as a double, or INFINITY if v (i) is the largest integer
+static double get_length (GrB_Vector v, GrB_Index i, bool is_int)
+{
+    double x = 0 ;
+    OK (GrB_Vector_extractElement_FP64 (&x, v, i)) ;
+    if (is_int && x == (double) INT32_MAX) x = INFINITY ;
+    return (x) ;
+}
+
+//****************************************************************************
+
+void test_PointToPointSSSP (void)
+{
+    LAGraph_Init (msg) ;
+    OK (GrB_Scalar_new (&Delta, GrB_FP64)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the matrix
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&T, f, msg)) ;
+        fclose (f) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, T)) ;
+
+        for (int kind = 0 ; kind <= 1 ; kind++)
+        {
+
+            //------------------------------------------------------------------
+            // construct a graph with positive weights, of type int32 or double
+            //------------------------------------------------------------------
+
+            bool is_int = (kind == 0) ;
+            if (is_int)
+            {
+                // A = min (max (abs (int32 (T)), 1), 255)
+                OK (GrB_Matrix_new (&A, GrB_INT32, n, n)) ;
+                OK (GrB_apply (A, NULL, NULL, GrB_ABS_INT32, T, NULL)) ;
+                OK (GrB_apply (A, NULL, NULL, GrB_MAX_INT32, A, 1, NULL)) ;
+                OK (GrB_apply (A, NULL, NULL, GrB_MIN_INT32, A, 255, NULL)) ;
+            }
+            else
+            {
+                // A = max (abs (double (T)), 0.5)
+                OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+                OK (GrB_apply (A, NULL, NULL, GrB_ABS_FP64, T, NULL)) ;
+                OK (GrB_apply (A, NULL, NULL, GrB_MAX_FP64, A, 0.5, NULL)) ;
+            }
+            OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+            //------------------------------------------------------------------
+            // landmark distances, for the A* heuristic
+            //------------------------------------------------------------------
+
+            GrB_Index landmark = n/2 ;
+            OK (GrB_Scalar_setElement (Delta, 30)) ;
+            OK (LAGr_SingleSourceShortestPath (&dland, G, landmark, Delta,
+                msg)) ;
+
+            //------------------------------------------------------------------
+            // compare with the single-source result
+            //------------------------------------------------------------------
+
+            GrB_Index src = 0 ;
+            OK (LAGr_SingleSourceShortestPath (&path_length, G, src, Delta,
+                msg)) ;
+
+            for (int cached = 0 ; cached <= 1 ; cached++)
+            {
+                // without G->emin, the full problem is solved
+                if (cached) OK (LAGraph_Cached_EMin (G, msg)) ;
+
+                for (GrB_Index dest = 0 ; dest < n ;
+                    dest += LAGRAPH_MAX (1, n/7))
+                {
+                    double len = get_length (path_length, dest, is_int) ;
+
+                    // h (j) = max (0, d (L,dest) - d (L,j)) for all nodes j
+                    // reachable from the landmark L
+                    double dlast = get_length (dland, dest, is_int) ;
+                    OK (GrB_Vector_new (&h, GrB_FP64, n)) ;
+                    for (GrB_Index j = 0 ; j < n && !isinf (dlast) ; j++)
+                    {
+                        double dj = get_length (dland, j, is_int) ;
+                        if (isinf (dj)) continue ;
+                        OK (GrB_Vector_setElement (h,
+                            LAGRAPH_MAX (0, dlast - dj), j)) ;
+                    }
+
+                    double Deltas [3] = { 1, 30, 1e6 } ;
+                    for (int kk = 0 ; kk < 3 ; kk++)
+                    {
+                        OK (GrB_Scalar_setElement (Delta, Deltas [kk])) ;
+                        for (int astar = 0 ; astar <= 1 ; astar++)
+                        {
+                            double len2 = 0 ;
+                            OK (LAGraph_PointToPointSSSP (&len2, G, src, dest,
+                                Delta, astar ? h : NULL, msg)) ;
+                            if (isinf (len))
+                            {
+                                TEST_CHECK (isinf (len2)) ;
+                            }
+                            else
+                            {
+                                double err = fabs (len - len2) /
+                                    LAGRAPH_MAX (1, len) ;
+                                TEST_CHECK (err < 1e-10) ;
+                                TEST_MSG ("dest %g: %g %g", (double) dest,
+                                    len, len2) ;
+                            }
+                        }
+                    }
+                    OK (GrB_free (&h)) ;
+                }
+            }
+
+            OK (GrB_free (&path_length)) ;
+            OK (GrB_free (&dland)) ;
+            OK (LAGraph_Delete (&G, msg)) ;
+        }
+        OK (GrB_free (&T)) ;
+    }
+
+    OK (GrB_free (&Delta)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+void test_PointToPointSSSP_errors (void)
+{
+    LAGraph_Init (msg) ;
+    OK (GrB_Scalar_new (&Delta, GrB_FP64)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    double len = 0 ;
+
+    // Delta is empty
+    int result = LAGraph_PointToPointSSSP (&len, G, 0, 1, Delta, NULL, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_EMPTY_OBJECT) ;
+
+    // Delta is zero
+    OK (GrB_Scalar_setElement (Delta, 0)) ;
+    result = LAGraph_PointToPointSSSP (&len, G, 0, 1, Delta, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    OK (GrB_Scalar_setElement (Delta, 2)) ;
+
+    // invalid target
+    result = LAGraph_PointToPointSSSP (&len, G, 0, 34, Delta, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+
+    // h has the wrong size
+    OK (GrB_Vector_new (&h, GrB_FP64, 3)) ;
+    result = LAGraph_PointToPointSSSP (&len, G, 0, 1, Delta, h, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+    OK (GrB_free (&h)) ;
+
+    // karate is boolean, which is not supported
+    result = LAGraph_PointToPointSSSP (&len, G, 0, 1, Delta, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
+
+    result = LAGraph_PointToPointSSSP (NULL, G, 0, 1, Delta, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (GrB_free (&Delta)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"PointToPointSSSP", test_PointToPointSSSP},
+    {"PointToPointSSSP_errors", test_PointToPointSSSP_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,245 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_SSaveGraph.c: test LAGraph_SSaveGraph/SLoadGraph
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL, G2 = NULL ;
+GrB_Matrix A = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "ldbc-undirected-example.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "A.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "matrix_int8.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "matrix_fp32.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "structure.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "full_symmetric.mtx",
+    LAGRAPH_UNKNOWN,              ""
+} ;
+
+//------------------------------------------------------------------------------
+// check_scalar: check if two cached scalars are the same
+//------------------------------------------------------------------------------
+
+static void check_scalar (GrB_Scalar s1, GrB_Scalar s2)
+{
+    TEST_CHECK ((s1 == NULL) == (s2 == NULL)) ;
+    if (s1 == NULL || s2 == NULL) return ;
+    GrB_Index n1, n2 ;
+    OK (GrB_Scalar_nvals (&n1, s1)) ;
+    OK (GrB_Scalar_nvals (&n2, s2)) ;
+    TEST_CHECK (n1 == n2) ;
+    if (n1 == 0) return ;
+    double x1 = 0, x2 = 1 ;
+    OK (GrB_Scalar_extractElement_FP64 (&x1, s1)) ;
+    OK (GrB_Scalar_extractElement_FP64 (&x2, s2)) ;
+    TEST_CHECK (x1 == x2) ;
+}
+
+//------------------------------------------------------------------------------
+// check_graph: check if two graphs and their cached properties are the same
+//------------------------------------------------------------------------------
+
+static void check_graph (LAGraph_Graph G1, LAGraph_Graph G2)
+{
+    bool ok = false ;
+    TEST_CHECK (G1->kind == G2->kind) ;
+    OK (LAGraph_Matrix_IsEqual (&ok, G1->A, G2->A, msg)) ;
+    TEST_CHECK (ok) ;
+
+    TEST_CHECK ((G1->AT == NULL) == (G2->AT == NULL)) ;
+    if (G1->AT != NULL && G2->AT != NULL)
+    {
+        OK (LAGraph_Matrix_IsEqual (&ok, G1->AT, G2->AT, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+
+    TEST_CHECK ((G1->out_degree == NULL) == (G2->out_degree == NULL)) ;
+    if (G1->out_degree != NULL && G2->out_degree != NULL)
+    {
+        OK (LAGraph_Vector_IsEqual (&ok, G1->out_degree, G2->out_degree,
+            msg)) ;
+        TEST_CHECK (ok) ;
+    }
+
+    TEST_CHECK ((G1->in_degree == NULL) == (G2->in_degree == NULL)) ;
+    if (G1->in_degree != NULL && G2->in_degree != NULL)
+    {
+        OK (LAGraph_Vector_IsEqual (&ok, G1->in_degree, G2->in_degree, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+
+    TEST_CHECK (G1->is_symmetric_structure == G2->is_symmetric_structure) ;
+    TEST_CHECK (G1->nself_edges == G2->nself_edges) ;
+    TEST_CHECK (G1->emin_state == G2->emin_state) ;
+    TEST_CHECK (G1->emax_state == G2->emax_state) ;
+    check_scalar (G1->emin, G2->emin) ;
+    check_scalar (G1->emax, G2->emax) ;
+    TEST_CHECK (G1->bfs_alpha == G2->bfs_alpha) ;
+    TEST_CHECK (G1->bfs_beta1 == G2->bfs_beta1) ;
+    TEST_CHECK (G1->bfs_beta2 == G2->bfs_beta2) ;
+    TEST_CHECK (G1->tc_method == G2->tc_method) ;
+    TEST_CHECK (G1->tc_presort == G2->tc_presort) ;
+}
+
+//****************************************************************************
+
+void test_SSaveGraph (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the graph
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+
+        for (int cached = 0 ; cached <= 1 ; cached++)
+        {
+            if (cached)
+            {
+                // compute all cached properties of G
+                OK (LAGraph_Cached_AT (G, msg)) ;
+                OK (LAGraph_Cached_OutDegree (G, msg)) ;
+                OK (LAGraph_Cached_InDegree (G, msg)) ;
+                OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+                OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+                OK (LAGraph_Cached_EMin (G, msg)) ;
+                OK (LAGraph_Cached_EMax (G, msg)) ;
+                OK (LAGraph_BreadthFirstSearch_Calibrate (G, 2, 42, msg)) ;
+                TEST_CHECK (G->bfs_alpha > 0) ;
+                if (G->kind == LAGraph_ADJACENCY_UNDIRECTED &&
+                    G->nself_edges == 0)
+                {
+                    OK (LAGraph_TriangleCount_Calibrate (G, 0, 42, msg)) ;
+                    TEST_CHECK (G->tc_method > 0) ;
+                }
+            }
+            else
+            {
+                // no cached properties
+                OK (LAGraph_DeleteCached (G, msg)) ;
+            }
+
+            // save the graph, load it back in, and compare
+            OK (LAGraph_SSaveGraph ("graph.lagraph", G, "test graph", msg)) ;
+            char *collection = NULL ;
+            OK (LAGraph_SLoadGraph ("graph.lagraph", &G2, &collection, msg)) ;
+            TEST_CHECK (collection != NULL) ;
+            if (collection == NULL) abort ( ) ;
+            TEST_CHECK (strcmp (collection, "test graph") == 0) ;
+            check_graph (G, G2) ;
+            OK (LAGraph_CheckGraph (G2, msg)) ;
+            OK (LAGraph_Delete (&G2, msg)) ;
+            LAGraph_Free ((void **) &collection, NULL) ;
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+void test_SSaveGraph_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    char *collection = NULL ;
+    int result = LAGraph_SSaveGraph (NULL, NULL, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_SLoadGraph (NULL, NULL, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // a set of matrices is not a graph
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_SSaveSet ("set.lagraph", &A, 1, "not a graph", msg)) ;
+    result = LAGraph_SLoadGraph ("set.lagraph", &G, &collection, msg) ;
+    printf ("result %d msg [%s]\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_IO_ERROR) ;
+    TEST_CHECK (G == NULL) ;
+    TEST_CHECK (collection == NULL) ;
+    OK (GrB_free (&A)) ;
+
+    // invalid triangle counting method and BFS thresholds
+    for (int k = 0 ; k <= 1 ; k++)
+    {
+        f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        if (k == 0)
+        {
+            G->tc_method = 99 ;
+        }
+        else
+        {
+            G->bfs_alpha = -2 ;
+            G->bfs_beta2 = 4 ;
+        }
+        OK (LAGraph_SSaveGraph ("bad.lagraph", G, "bad graph", msg)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+        result = LAGraph_SLoadGraph ("bad.lagraph", &G, &collection, msg) ;
+        printf ("result %d msg [%s]\n", result, msg) ;
+        TEST_CHECK (result == GrB_INVALID_VALUE) ;
+        TEST_CHECK (G == NULL) ;
+        TEST_CHECK (collection == NULL) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"SSaveGraph", test_SSaveGraph},
+    {"SSaveGraph_errors", test_SSaveGraph_errors},
+    {NULL, NULL}
+};
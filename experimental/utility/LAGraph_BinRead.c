@@ -0,0 +1,423 @@
+//------------------------------------------------------------------------------
+// LAGraph_BinRead: read a matrix from a binary *.grb file
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_BinRead reads a matrix from a binary *.grb file written by
+// LAGraph_BinWrite.  The file is read starting at the current position of f,
+// and on output f is positioned just past the matrix.
+
+// If f is a regular file on a POSIX system, the file is mapped into memory
+// with mmap, and the arrays are copied out of the mapped pages in parallel,
+// without any intermediate stdio buffering.  The arrays cannot be handed to
+// GraphBLAS directly from the mapped pages, since GraphBLAS takes ownership
+// of any array passed to GxB_Matrix_pack_* and frees it when the matrix is
+// freed.  Each array is thus allocated once, filled, and then packed into the
+// matrix in O(1) time.  If the file cannot be mapped (a pipe or stdin, for
+// example), fread is used instead.
+
+// The sizes of the arrays are checked against the size of the file before
+// any array is allocated, so a truncated or corrupted file results in an
+// error rather than a huge allocation.
+
+// This method requires SuiteSparse:GraphBLAS.
+
+#define LG_FREE_WORK                            \
+{                                               \
+    bin_close (&r) ;                            \
+    LAGraph_Free ((void **) &Ap, NULL) ;        \
+    LAGraph_Free ((void **) &Ab, NULL) ;        \
+    LAGraph_Free ((void **) &Ah, NULL) ;        \
+    LAGraph_Free ((void **) &Ai, NULL) ;        \
+    LAGraph_Free ((void **) &Ax, NULL) ;        \
+}
+
+#define LG_FREE_ALL                             \
+{                                               \
+    LG_FREE_WORK ;                              \
+    GrB_free (A) ;                              \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+#if defined ( __unix__ ) || defined ( __APPLE__ )
+#define LG_BIN_MMAP 1
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define LG_BIN_MMAP 0
+#endif
+
+//------------------------------------------------------------------------------
+// bin_reader: a file, read with mmap if possible, or fread otherwise
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    FILE *f ;               // the file being read
+    const uint8_t *base ;   // the mapped file, or NULL if not mapped
+    size_t size ;           // size of the mapped file
+    size_t start ;          // position of f when bin_open was called
+    size_t pos ;            // current position in the mapped file
+    int nthreads ;          // # of threads for copying from the mapped file
+}
+bin_reader ;
+
+// copy in chunks of at least 1MB
+#define LG_BIN_CHUNK (1024*1024)
+
+static void bin_open (bin_reader *r, FILE *f, int nthreads)
+{
+    r->f = f ;
+    r->base = NULL ;
+    r->size = 0 ;
+    r->start = 0 ;
+    r->pos = 0 ;
+    r->nthreads = nthreads ;
+    #if LG_BIN_MMAP
+    {
+        int fd = fileno (f) ;
+        struct stat st ;
+        off_t start = ftello (f) ;
+        if (fd < 0 || start < 0 || fstat (fd, &st) != 0
+            || !S_ISREG (st.st_mode) || st.st_size <= start)
+        {
+            // not a regular file: use fread instead
+            return ;
+        }
+        void *p = mmap (NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE,
+            fd, 0) ;
+        if (p == MAP_FAILED) return ;
+        #ifdef MADV_SEQUENTIAL
+        madvise (p, (size_t) st.st_size, MADV_SEQUENTIAL) ;
+        #endif
+        r->base = (const uint8_t *) p ;
+        r->size = (size_t) st.st_size ;
+        r->start = (size_t) start ;
+        r->pos = (size_t) start ;
+    }
+    #endif
+}
+
+static void bin_close (bin_reader *r)
+{
+    #if LG_BIN_MMAP
+    if (r->base != NULL)
+    {
+        // leave f positioned just past the data read from the mapped file
+        fseeko (r->f, (off_t) r->pos, SEEK_SET) ;
+        munmap ((void *) r->base, r->size) ;
+        r->base = NULL ;
+    }
+    #endif
+}
+
+// return true if n items of size s remain in the mapped file, or if the file
+// is not mapped (in which case the size of the file is unknown)
+static bool bin_fits (const bin_reader *r, size_t s, uint64_t n)
+{
+    if (r->base == NULL) return (true) ;
+    size_t remaining = r->size - r->pos ;
+    return (s == 0 || n <= remaining / s) ;
+}
+
+static bool bin_read (bin_reader *r, void *p, size_t s, uint64_t n)
+{
+    if (n == 0) return (true) ;
+    if (r->base == NULL)
+    {
+        return (fread (p, s, n, r->f) == n) ;
+    }
+    if (!bin_fits (r, s, n)) return (false) ;
+    size_t nbytes = s * n ;
+    const uint8_t *src = r->base + r->pos ;
+    uint8_t *dst = (uint8_t *) p ;
+    int64_t ntasks = LAGRAPH_MIN (nbytes / LG_BIN_CHUNK, 4 * r->nthreads) ;
+    if (ntasks <= 1 || r->nthreads <= 1)
+    {
+        memcpy (dst, src, nbytes) ;
+    }
+    else
+    {
+        int nth = r->nthreads ;
+        int64_t tid ;
+        #pragma omp parallel for num_threads(nth) schedule(dynamic,1)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            size_t k1 = (size_t) (((double) tid    ) / ntasks * nbytes) ;
+            size_t k2 = (tid == ntasks-1) ? nbytes :
+                        (size_t) (((double) tid + 1) / ntasks * nbytes) ;
+            memcpy (dst + k1, src + k1, k2 - k1) ;
+        }
+    }
+    r->pos += nbytes ;
+    return (true) ;
+}
+
+#define FREAD(p,s,n)                                                    \
+{                                                                       \
+    LG_ASSERT_MSG (bin_read (&r, p, s, n), LAGRAPH_IO_ERROR,            \
+        "unable to read from the file") ;                               \
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_BinRead
+//------------------------------------------------------------------------------
+
+int LAGraph_BinRead
+(
+    // output:
+    GrB_Matrix *A,          // matrix read from the file
+    // input:
+    FILE *f,                // file to read it from, already open
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *Ap = NULL, *Ai = NULL, *Ah = NULL ;
+    int8_t *Ab = NULL ;
+    void *Ax = NULL ;
+    bin_reader r ;
+    r.base = NULL ;
+    LG_ASSERT (A != NULL && f != NULL, GrB_NULL_POINTER) ;
+    (*A) = NULL ;
+
+#if !LAGRAPH_SUITESPARSE
+    LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED,
+        "SuiteSparse:GraphBLAS required to read binary *.grb files") ;
+#else
+
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    bin_open (&r, f, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // read the header (and ignore it)
+    //--------------------------------------------------------------------------
+
+    // The header is informational only, for "head" command, so the file can
+    // be visually inspected.
+
+    char header [LAGRAPH_BIN_HEADER] ;
+    FREAD (header, sizeof (char), LAGRAPH_BIN_HEADER) ;
+
+    //--------------------------------------------------------------------------
+    // read the scalar content
+    //--------------------------------------------------------------------------
+
+    GxB_Format_Value fmt = -999 ;
+    int32_t kind, typecode ;
+    double hyper = -999 ;
+    GrB_Type type ;
+    GrB_Index nrows, ncols, nvals, nvec ;
+    size_t typesize ;
+    int64_t nonempty ;
+
+    FREAD (&fmt,      sizeof (GxB_Format_Value), 1) ;
+    FREAD (&kind,     sizeof (int32_t), 1) ;
+    FREAD (&hyper,    sizeof (double), 1) ;
+    FREAD (&nrows,    sizeof (GrB_Index), 1) ;
+    FREAD (&ncols,    sizeof (GrB_Index), 1) ;
+    FREAD (&nonempty, sizeof (int64_t), 1) ;
+    FREAD (&nvec,     sizeof (GrB_Index), 1) ;
+    FREAD (&nvals,    sizeof (GrB_Index), 1) ;
+    FREAD (&typecode, sizeof (int32_t), 1) ;
+    FREAD (&typesize, sizeof (size_t), 1) ;
+
+    bool iso = false ;
+    if (kind > 100)
+    {
+        iso = true ;
+        kind = kind - 100 ;
+    }
+
+    bool is_hyper  = (kind == GxB_HYPERSPARSE) ;
+    bool is_sparse = (kind == 0 || kind == GxB_SPARSE) ;
+    bool is_bitmap = (kind == GxB_BITMAP) ;
+    bool is_full   = (kind == GxB_FULL) ;
+    bool by_row    = (fmt == GxB_BY_ROW) ;
+    LG_ASSERT_MSG ((is_hyper || is_sparse || is_bitmap || is_full)
+        && (by_row || fmt == GxB_BY_COL), LAGRAPH_IO_ERROR,
+        "invalid matrix format") ;
+
+    switch (typecode)
+    {
+        case 0:  type = GrB_BOOL        ; break ;
+        case 1:  type = GrB_INT8        ; break ;
+        case 2:  type = GrB_INT16       ; break ;
+        case 3:  type = GrB_INT32       ; break ;
+        case 4:  type = GrB_INT64       ; break ;
+        case 5:  type = GrB_UINT8       ; break ;
+        case 6:  type = GrB_UINT16      ; break ;
+        case 7:  type = GrB_UINT32      ; break ;
+        case 8:  type = GrB_UINT64      ; break ;
+        case 9:  type = GrB_FP32        ; break ;
+        case 10: type = GrB_FP64        ; break ;
+        default:
+            // unknown or unsupported type (GxB_FC32 and GxB_FC64)
+            LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED, "type not supported") ;
+    }
+    size_t expected_typesize ;
+    GRB_TRY (GxB_Type_size (&expected_typesize, type)) ;
+    LG_ASSERT_MSG (typesize == expected_typesize, LAGRAPH_IO_ERROR,
+        "invalid type size") ;
+
+    //--------------------------------------------------------------------------
+    // determine the size of each array and check them against the file
+    //--------------------------------------------------------------------------
+
+    GrB_Index Ap_len = 0, Ah_len = 0, Ab_len = 0, Ai_len = 0, Ax_len = 0 ;
+    if (is_hyper)
+    {
+        LG_ASSERT_MSG (nvec < GrB_INDEX_MAX, LAGRAPH_IO_ERROR,
+            "invalid matrix dimensions") ;
+        Ap_len = nvec+1 ;
+        Ah_len = nvec ;
+        Ai_len = nvals ;
+        Ax_len = nvals ;
+    }
+    else if (is_sparse)
+    {
+        LG_ASSERT_MSG (nvec == (by_row ? nrows : ncols), LAGRAPH_IO_ERROR,
+            "invalid matrix dimensions") ;
+        Ap_len = nvec+1 ;
+        Ai_len = nvals ;
+        Ax_len = nvals ;
+    }
+    else
+    {
+        LG_ASSERT_MSG (ncols == 0 || nrows <= GrB_INDEX_MAX / ncols,
+            LAGRAPH_IO_ERROR, "invalid matrix dimensions") ;
+        Ab_len = is_bitmap ? (nrows*ncols) : 0 ;
+        Ax_len = nrows*ncols ;
+    }
+    if (iso) Ax_len = 1 ;
+
+    // Each length is checked on its own first, so that the sum of the three
+    // integer array lengths cannot overflow.
+    LG_ASSERT_MSG (
+        bin_fits (&r, sizeof (GrB_Index), Ap_len) &&
+        bin_fits (&r, sizeof (GrB_Index), Ah_len) &&
+        bin_fits (&r, sizeof (GrB_Index), Ai_len) &&
+        bin_fits (&r, sizeof (GrB_Index), Ap_len + Ah_len + Ai_len) &&
+        bin_fits (&r, sizeof (int8_t), Ab_len) &&
+        bin_fits (&r, typesize, Ax_len), LAGRAPH_IO_ERROR,
+        "file is truncated") ;
+
+    //--------------------------------------------------------------------------
+    // allocate and read the array content
+    //--------------------------------------------------------------------------
+
+    // Each array is allocated with at least one entry, since GraphBLAS does
+    // not accept a NULL array for a matrix with no entries.
+
+    GrB_Index Ap_size = LAGRAPH_MAX (Ap_len, 1) * sizeof (GrB_Index) ;
+    GrB_Index Ah_size = LAGRAPH_MAX (Ah_len, 1) * sizeof (GrB_Index) ;
+    GrB_Index Ab_size = LAGRAPH_MAX (Ab_len, 1) * sizeof (int8_t) ;
+    GrB_Index Ai_size = LAGRAPH_MAX (Ai_len, 1) * sizeof (GrB_Index) ;
+    GrB_Index Ax_size = LAGRAPH_MAX (Ax_len, 1) * typesize ;
+
+    if (is_hyper || is_sparse)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Ap, LAGRAPH_MAX (Ap_len, 1),
+            sizeof (GrB_Index), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Ai, LAGRAPH_MAX (Ai_len, 1),
+            sizeof (GrB_Index), msg)) ;
+        FREAD (Ap, sizeof (GrB_Index), Ap_len) ;
+        if (is_hyper)
+        {
+            LG_TRY (LAGraph_Malloc ((void **) &Ah, LAGRAPH_MAX (Ah_len, 1),
+                sizeof (GrB_Index), msg)) ;
+            FREAD (Ah, sizeof (GrB_Index), Ah_len) ;
+        }
+        FREAD (Ai, sizeof (GrB_Index), Ai_len) ;
+    }
+    else if (is_bitmap)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Ab, LAGRAPH_MAX (Ab_len, 1),
+            sizeof (int8_t), msg)) ;
+        FREAD (Ab, sizeof (int8_t), Ab_len) ;
+    }
+    LG_TRY (LAGraph_Malloc ((void **) &Ax, LAGRAPH_MAX (Ax_len, 1), typesize,
+        msg)) ;
+    FREAD (Ax, typesize, Ax_len) ;
+
+    //--------------------------------------------------------------------------
+    // pack the arrays into the matrix
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (A, type, nrows, ncols)) ;
+    if (is_hyper)
+    {
+        if (by_row)
+        {
+            GRB_TRY (GxB_Matrix_pack_HyperCSR (*A, &Ap, &Ah, &Ai, &Ax,
+                Ap_size, Ah_size, Ai_size, Ax_size, iso, nvec, false, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Matrix_pack_HyperCSC (*A, &Ap, &Ah, &Ai, &Ax,
+                Ap_size, Ah_size, Ai_size, Ax_size, iso, nvec, false, NULL)) ;
+        }
+    }
+    else if (is_sparse)
+    {
+        if (by_row)
+        {
+            GRB_TRY (GxB_Matrix_pack_CSR (*A, &Ap, &Ai, &Ax,
+                Ap_size, Ai_size, Ax_size, iso, false, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Matrix_pack_CSC (*A, &Ap, &Ai, &Ax,
+                Ap_size, Ai_size, Ax_size, iso, false, NULL)) ;
+        }
+    }
+    else if (is_bitmap)
+    {
+        if (by_row)
+        {
+            GRB_TRY (GxB_Matrix_pack_BitmapR (*A, &Ab, &Ax,
+                Ab_size, Ax_size, iso, nvals, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Matrix_pack_BitmapC (*A, &Ab, &Ax,
+                Ab_size, Ax_size, iso, nvals, NULL)) ;
+        }
+    }
+    else
+    {
+        if (by_row)
+        {
+            GRB_TRY (GxB_Matrix_pack_FullR (*A, &Ax, Ax_size, iso, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Matrix_pack_FullC (*A, &Ax, Ax_size, iso, NULL)) ;
+        }
+    }
+
+    GRB_TRY (GxB_set (*A, GxB_HYPER_SWITCH, hyper)) ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+#endif
+}
@@ -0,0 +1,366 @@
+//------------------------------------------------------------------------------
+// LAGraph_BinWrite: write a matrix to a binary *.grb file
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_BinWrite writes a matrix to a file in the binary *.grb format, which
+// is a raw dump of the internal arrays of a SuiteSparse:GraphBLAS matrix.  The
+// file starts with an ASCII header of LAGRAPH_BIN_HEADER bytes (informational
+// only, so the file can be inspected with the "head" command), followed by
+// the scalar properties of the matrix and then its Ap, Ah, Ab, Ai, and Ax
+// arrays, as present for its sparsity format.  The file can be read back in
+// with LAGraph_BinRead.
+
+// The contents of A are unpacked in O(1) time, written to the file, and then
+// packed back into A, so A is unchanged on output (except that any pending
+// work is finished and the matrix is returned with its indices sorted).  The
+// file is not portable to a system with a different endianness.
+
+// This method requires SuiteSparse:GraphBLAS.
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+#if LAGRAPH_SUITESPARSE
+
+//------------------------------------------------------------------------------
+// bin_write: write an array to the file
+//------------------------------------------------------------------------------
+
+static inline bool bin_write (const void *p, size_t s, size_t n, FILE *f)
+{
+    return (n == 0 || fwrite (p, s, n, f) == n) ;
+}
+
+#define FWRITE(p,s,n) ok = ok && bin_write (p, s, n, f)
+
+#endif
+
+//------------------------------------------------------------------------------
+// LAGraph_BinWrite
+//------------------------------------------------------------------------------
+
+int LAGraph_BinWrite
+(
+    // input/output:
+    GrB_Matrix A,           // matrix to write to the file
+    // input:
+    FILE *f,                // file to write it to, already open
+    const char *comments,   // comments to add to the file, up to 210
+                            // characters in length, not including the
+                            // terminating null byte.  Ignored if NULL.
+                            // Characters past the 210 limit are silently
+                            // ignored.
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LG_ASSERT (A != NULL && f != NULL, GrB_NULL_POINTER) ;
+
+#if !LAGRAPH_SUITESPARSE
+    LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED,
+        "SuiteSparse:GraphBLAS required to write binary *.grb files") ;
+#else
+
+    GRB_TRY (GrB_wait (A, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // determine the basic matrix properties
+    //--------------------------------------------------------------------------
+
+    GxB_Format_Value fmt = -999 ;
+    int32_t kind ;
+    double hyper = -999 ;
+    GRB_TRY (GxB_get (A, GxB_FORMAT, &fmt)) ;
+    GRB_TRY (GxB_get (A, GxB_HYPER_SWITCH, &hyper)) ;
+    GRB_TRY (GxB_get (A, GxB_SPARSITY_STATUS, &kind)) ;
+
+    bool is_hyper  = (kind == GxB_HYPERSPARSE) ;
+    bool is_sparse = (kind == GxB_SPARSE) ;
+    bool is_bitmap = (kind == GxB_BITMAP) ;
+    bool is_full   = (kind == GxB_FULL) ;
+    bool by_row    = (fmt == GxB_BY_ROW) ;
+    LG_ASSERT (is_hyper || is_sparse || is_bitmap || is_full, GrB_INVALID_VALUE);
+
+    GrB_Type type ;
+    GrB_Index nrows, ncols, nvals, nvec ;
+    size_t typesize ;
+    GRB_TRY (GxB_Matrix_type (&type, A)) ;
+    GRB_TRY (GxB_Type_size (&typesize, type)) ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, A)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+
+    //--------------------------------------------------------------------------
+    // determine the type code
+    //--------------------------------------------------------------------------
+
+    char typename [LAGRAPH_BIN_HEADER] ;
+    int32_t typecode ;
+    if      (type == GrB_BOOL  ) typecode =  0 ;
+    else if (type == GrB_INT8  ) typecode =  1 ;
+    else if (type == GrB_INT16 ) typecode =  2 ;
+    else if (type == GrB_INT32 ) typecode =  3 ;
+    else if (type == GrB_INT64 ) typecode =  4 ;
+    else if (type == GrB_UINT8 ) typecode =  5 ;
+    else if (type == GrB_UINT16) typecode =  6 ;
+    else if (type == GrB_UINT32) typecode =  7 ;
+    else if (type == GrB_UINT64) typecode =  8 ;
+    else if (type == GrB_FP32  ) typecode =  9 ;
+    else if (type == GrB_FP64  ) typecode = 10 ;
+    else
+    {
+        // unsupported type (GxB_FC32 and GxB_FC64 not yet supported)
+        LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED, "type not supported") ;
+    }
+    LG_TRY (LAGraph_Matrix_TypeName (typename, A, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // unpack the matrix
+    //--------------------------------------------------------------------------
+
+    // The matrix is unpacked with its indices sorted (jumbled is NULL), since
+    // the file format does not record the jumbled state.
+
+    GrB_Index *Ap = NULL, *Ai = NULL, *Ah = NULL ;
+    void *Ax = NULL ;
+    int8_t *Ab = NULL ;
+    GrB_Index Ap_size = 0, Ah_size = 0, Ab_size = 0, Ai_size = 0, Ax_size = 0 ;
+    bool iso = false ;
+    char *fmt_string ;
+
+    if (is_hyper)
+    {
+        if (by_row)
+        {
+            GRB_TRY (GxB_Matrix_unpack_HyperCSR (A, &Ap, &Ah, &Ai, &Ax,
+                &Ap_size, &Ah_size, &Ai_size, &Ax_size, &iso, &nvec, NULL,
+                NULL)) ;
+            fmt_string = "HCSR" ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Matrix_unpack_HyperCSC (A, &Ap, &Ah, &Ai, &Ax,
+                &Ap_size, &Ah_size, &Ai_size, &Ax_size, &iso, &nvec, NULL,
+                NULL)) ;
+            fmt_string = "HCSC" ;
+        }
+    }
+    else if (is_sparse)
+    {
+        if (by_row)
+        {
+            GRB_TRY (GxB_Matrix_unpack_CSR (A, &Ap, &Ai, &Ax,
+                &Ap_size, &Ai_size, &Ax_size, &iso, NULL, NULL)) ;
+            nvec = nrows ;
+            fmt_string = "CSR " ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Matrix_unpack_CSC (A, &Ap, &Ai, &Ax,
+                &Ap_size, &Ai_size, &Ax_size, &iso, NULL, NULL)) ;
+            nvec = ncols ;
+            fmt_string = "CSC " ;
+        }
+    }
+    else if (is_bitmap)
+    {
+        if (by_row)
+        {
+            GRB_TRY (GxB_Matrix_unpack_BitmapR (A, &Ab, &Ax,
+                &Ab_size, &Ax_size, &iso, &nvals, NULL)) ;
+            nvec = nrows ;
+            fmt_string = "BITMAPR" ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Matrix_unpack_BitmapC (A, &Ab, &Ax,
+                &Ab_size, &Ax_size, &iso, &nvals, NULL)) ;
+            nvec = ncols ;
+            fmt_string = "BITMAPC" ;
+        }
+    }
+    else
+    {
+        if (by_row)
+        {
+            GRB_TRY (GxB_Matrix_unpack_FullR (A, &Ax, &Ax_size, &iso, NULL)) ;
+            nvec = nrows ;
+            fmt_string = "FULLR" ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Matrix_unpack_FullC (A, &Ax, &Ax_size, &iso, NULL)) ;
+            nvec = ncols ;
+            fmt_string = "FULLC" ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // write the header in ascii
+    //--------------------------------------------------------------------------
+
+    // From this point on, A is empty and its content must be packed back
+    // into it, even if an I/O error occurs.
+
+    bool ok = true ;
+    char version [LAGRAPH_BIN_HEADER] ;
+    snprintf (version, LAGRAPH_BIN_HEADER, "%d.%d.%d (LAGraph %d.%d.%d)",
+        GxB_IMPLEMENTATION_MAJOR, GxB_IMPLEMENTATION_MINOR,
+        GxB_IMPLEMENTATION_SUB, LAGRAPH_VERSION_MAJOR, LAGRAPH_VERSION_MINOR,
+        LAGRAPH_VERSION_UPDATE) ;
+    version [25] = '\0' ;
+
+    char user [LAGRAPH_BIN_HEADER] ;
+    for (int k = 0 ; k < LAGRAPH_BIN_HEADER ; k++) user [k] = ' ' ;
+    user [0] = '\n' ;
+    if (comments != NULL)
+    {
+        strncpy (user, comments, 210) ;
+    }
+    user [210] = '\0' ;
+    typename [72] = '\0' ;
+
+    char header [LAGRAPH_BIN_HEADER] ;
+    int32_t len = snprintf (header, LAGRAPH_BIN_HEADER,
+        "SuiteSparse:GraphBLAS matrix\nv%-25s\n"
+        "nrows:  %-18" PRIu64 "\n"
+        "ncols:  %-18" PRIu64 "\n"
+        "nvec:   %-18" PRIu64 "\n"
+        "nvals:  %-18" PRIu64 "\n"
+        "format: %-8s\n"
+        "size:   %-18" PRIu64 "\n"
+        "type:   %-72s\n"
+        "iso:    %1d\n"
+        "%-210s\n\n",
+        version, nrows, ncols, nvec, nvals, fmt_string, (uint64_t) typesize,
+        typename, iso, user) ;
+    len = LAGRAPH_MIN (len, LAGRAPH_BIN_HEADER) ;
+    for (int32_t k = len ; k < LAGRAPH_BIN_HEADER ; k++) header [k] = ' ' ;
+    header [LAGRAPH_BIN_HEADER-1] = '\0' ;
+    FWRITE (header, sizeof (char), LAGRAPH_BIN_HEADER) ;
+
+    //--------------------------------------------------------------------------
+    // write the scalar content
+    //--------------------------------------------------------------------------
+
+    // kind is 1, 2, 4, or 8: add 100 if the matrix is iso
+    int32_t kind_code = kind + (iso ? 100 : 0) ;
+    int64_t nonempty = -1 ;
+    FWRITE (&fmt,       sizeof (GxB_Format_Value), 1) ;
+    FWRITE (&kind_code, sizeof (int32_t), 1) ;
+    FWRITE (&hyper,     sizeof (double), 1) ;
+    FWRITE (&nrows,     sizeof (GrB_Index), 1) ;
+    FWRITE (&ncols,     sizeof (GrB_Index), 1) ;
+    FWRITE (&nonempty,  sizeof (int64_t), 1) ;
+    FWRITE (&nvec,      sizeof (GrB_Index), 1) ;
+    FWRITE (&nvals,     sizeof (GrB_Index), 1) ;
+    FWRITE (&typecode,  sizeof (int32_t), 1) ;
+    FWRITE (&typesize,  sizeof (size_t), 1) ;
+
+    //--------------------------------------------------------------------------
+    // write the array content
+    //--------------------------------------------------------------------------
+
+    if (is_hyper)
+    {
+        FWRITE (Ap, sizeof (GrB_Index), nvec+1) ;
+        FWRITE (Ah, sizeof (GrB_Index), nvec) ;
+        FWRITE (Ai, sizeof (GrB_Index), nvals) ;
+        FWRITE (Ax, typesize, (iso ? 1 : nvals)) ;
+    }
+    else if (is_sparse)
+    {
+        FWRITE (Ap, sizeof (GrB_Index), nvec+1) ;
+        FWRITE (Ai, sizeof (GrB_Index), nvals) ;
+        FWRITE (Ax, typesize, (iso ? 1 : nvals)) ;
+    }
+    else if (is_bitmap)
+    {
+        FWRITE (Ab, sizeof (int8_t), nrows*ncols) ;
+        FWRITE (Ax, typesize, (iso ? 1 : (nrows*ncols))) ;
+    }
+    else
+    {
+        FWRITE (Ax, typesize, (iso ? 1 : (nrows*ncols))) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pack the matrix back into A
+    //--------------------------------------------------------------------------
+
+    if (is_hyper)
+    {
+        if (by_row)
+        {
+            GRB_TRY (GxB_Matrix_pack_HyperCSR (A, &Ap, &Ah, &Ai, &Ax,
+                Ap_size, Ah_size, Ai_size, Ax_size, iso, nvec, false, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Matrix_pack_HyperCSC (A, &Ap, &Ah, &Ai, &Ax,
+                Ap_size, Ah_size, Ai_size, Ax_size, iso, nvec, false, NULL)) ;
+        }
+    }
+    else if (is_sparse)
+    {
+        if (by_row)
+        {
+            GRB_TRY (GxB_Matrix_pack_CSR (A, &Ap, &Ai, &Ax,
+                Ap_size, Ai_size, Ax_size, iso, false, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Matrix_pack_CSC (A, &Ap, &Ai, &Ax,
+                Ap_size, Ai_size, Ax_size, iso, false, NULL)) ;
+        }
+    }
+    else if (is_bitmap)
+    {
+        if (by_row)
+        {
+            GRB_TRY (GxB_Matrix_pack_BitmapR (A, &Ab, &Ax,
+                Ab_size, Ax_size, iso, nvals, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Matrix_pack_BitmapC (A, &Ab, &Ax,
+                Ab_size, Ax_size, iso, nvals, NULL)) ;
+        }
+    }
+    else
+    {
+        if (by_row)
+        {
+            GRB_TRY (GxB_Matrix_pack_FullR (A, &Ax, Ax_size, iso, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Matrix_pack_FullC (A, &Ax, Ax_size, iso, NULL)) ;
+        }
+    }
+
+    GRB_TRY (GxB_set (A, GxB_HYPER_SWITCH, hyper)) ;
+    LG_ASSERT_MSG (ok, LAGRAPH_IO_ERROR, "unable to write to the file") ;
+    return (GrB_SUCCESS) ;
+#endif
+}
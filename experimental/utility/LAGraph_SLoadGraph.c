@@ -0,0 +1,274 @@
+//------------------------------------------------------------------------------
+// LAGraph_SLoadGraph: load a graph and its cached properties from a file
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_SLoadGraph loads a graph from a *.lagraph file written by
+// LAGraph_SSaveGraph, including all of the cached properties that were
+// present when the graph was saved.  The caller is responsible for freeing
+// the output of this method, via:
+
+//      LAGraph_Free ((void **) &collection, NULL) ;
+//      LAGraph_Delete (&G, msg) ;
+
+// Items in the file with names other than those written by LAGraph_SSaveGraph
+// are ignored.  The graph is checked with LAGraph_CheckGraph before it is
+// returned, so an inconsistent file results in an error.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                                                \
+{                                                                   \
+    if (f != NULL && f != stdin) fclose (f) ;                       \
+    f = NULL ;                                                      \
+    LAGraph_SFreeContents (&Contents, ncontents) ;                  \
+    GrB_free (&A) ;                                                 \
+    GrB_free (&AT) ;                                                \
+    GrB_free (&Prop) ;                                              \
+    GrB_free (&Dout) ;                                              \
+    GrB_free (&Din) ;                                               \
+    GrB_free (&Emin) ;                                              \
+    GrB_free (&Emax) ;                                              \
+    GrB_free (&Bfs) ;                                               \
+    GrB_free (&Tc) ;                                                \
+}
+
+#define LG_FREE_ALL                                                 \
+{                                                                   \
+    LG_FREE_WORK ;                                                  \
+    LAGraph_Delete (&G, NULL) ;                                     \
+    LAGraph_Free ((void **) &collection, NULL) ;                    \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LAGraph_SLoadGraph
+//------------------------------------------------------------------------------
+
+int LAGraph_SLoadGraph          // load a graph from a *.lagraph file
+(
+    // input:
+    char *filename,             // name of file to read; NULL for stdin
+    // outputs:
+    LAGraph_Graph *G_handle,    // graph loaded from the file
+    char **collection_handle,   // name of the graph
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    FILE *f = stdin ;
+    char *collection = NULL ;
+    LAGraph_Contents *Contents = NULL ;
+    GrB_Index ncontents = 0 ;
+    LAGraph_Graph G = NULL ;
+    GrB_Matrix A = NULL, AT = NULL, Prop = NULL, Dout = NULL, Din = NULL,
+        Emin = NULL, Emax = NULL, Bfs = NULL, Tc = NULL ;
+
+    LG_ASSERT (G_handle != NULL && collection_handle != NULL,
+        GrB_NULL_POINTER) ;
+    (*G_handle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // read the file
+    //--------------------------------------------------------------------------
+
+    if (filename != NULL)
+    {
+        f = fopen (filename, "r") ;
+        LG_ASSERT_MSG (f != NULL,
+            LAGRAPH_IO_ERROR, "unable to open input file") ;
+    }
+    LG_TRY (LAGraph_SRead (f, &collection, &Contents, &ncontents, msg)) ;
+    if (filename != NULL)
+    {
+        fclose (f) ;
+    }
+    f = NULL ;
+
+    //--------------------------------------------------------------------------
+    // convert each matrix item to its component of the graph
+    //--------------------------------------------------------------------------
+
+    for (GrB_Index i = 0 ; i < ncontents ; i++)
+    {
+        const char *name = Contents [i].name ;
+        GrB_Matrix *Item = NULL ;
+        if (Contents [i].kind == LAGraph_matrix_kind)
+        {
+            if      (MATCHNAME (name, "A")) Item = &A ;
+            else if (MATCHNAME (name, "AT")) Item = &AT ;
+            else if (MATCHNAME (name, "properties")) Item = &Prop ;
+            else if (MATCHNAME (name, "out_degree")) Item = &Dout ;
+            else if (MATCHNAME (name, "in_degree")) Item = &Din ;
+            else if (MATCHNAME (name, "emin")) Item = &Emin ;
+            else if (MATCHNAME (name, "emax")) Item = &Emax ;
+            else if (MATCHNAME (name, "bfs")) Item = &Bfs ;
+            else if (MATCHNAME (name, "triangle_count")) Item = &Tc ;
+        }
+        if (Item != NULL)
+        {
+            LG_ASSERT_MSG ((*Item) == NULL, LAGRAPH_IO_ERROR,
+                "invalid file: duplicate graph component") ;
+            GrB_Type ctype = NULL ;
+            LG_TRY (LAGraph_TypeFromName (&ctype, Contents [i].type_name, msg));
+            GRB_TRY (GrB_Matrix_deserialize (Item, ctype, Contents [i].blob,
+                Contents [i].blob_size)) ;
+        }
+        // free the ith blob
+        LAGraph_Free ((void **) &(Contents [i].blob), NULL) ;
+    }
+
+    LG_ASSERT_MSG (A != NULL && Prop != NULL, LAGRAPH_IO_ERROR,
+        "invalid file: not a graph") ;
+
+    //--------------------------------------------------------------------------
+    // get the scalar components of the graph
+    //--------------------------------------------------------------------------
+
+    int64_t properties [LAGRAPH_SGRAPH_NPROPERTIES] ;
+    GrB_Index pnrows, pncols ;
+    GRB_TRY (GrB_Matrix_nrows (&pnrows, Prop)) ;
+    GRB_TRY (GrB_Matrix_ncols (&pncols, Prop)) ;
+    LG_ASSERT_MSG (pnrows == 1 && pncols >= LAGRAPH_SGRAPH_NPROPERTIES,
+        LAGRAPH_IO_ERROR, "invalid file: graph properties") ;
+    for (int k = 0 ; k < LAGRAPH_SGRAPH_NPROPERTIES ; k++)
+    {
+        properties [k] = LAGRAPH_UNKNOWN ;
+        GRB_TRY (GrB_Matrix_extractElement_INT64 (&(properties [k]), Prop,
+            0, k)) ;
+    }
+    LAGraph_Kind kind = (LAGraph_Kind) properties [0] ;
+    LG_ASSERT_MSG (kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        kind == LAGraph_ADJACENCY_DIRECTED, LAGRAPH_IO_ERROR,
+        "invalid file: unknown kind of graph") ;
+
+    //--------------------------------------------------------------------------
+    // construct the graph
+    //--------------------------------------------------------------------------
+
+    GrB_Index nrows, ncols ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, A)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, A)) ;
+    LG_TRY (LAGraph_New (&G, &A, kind, msg)) ;
+
+    G->is_symmetric_structure = (LAGraph_Boolean) properties [1] ;
+    G->nself_edges = properties [2] ;
+    G->AT = AT ;
+    AT = NULL ;
+
+    // convert each single-column matrix back into a degree vector
+    if (Dout != NULL)
+    {
+        GRB_TRY (GrB_Vector_new (&(G->out_degree), GrB_INT64, nrows)) ;
+        GRB_TRY (GrB_Col_extract (G->out_degree, NULL, NULL, Dout, GrB_ALL,
+            nrows, 0, NULL)) ;
+    }
+    if (Din != NULL)
+    {
+        GRB_TRY (GrB_Vector_new (&(G->in_degree), GrB_INT64, ncols)) ;
+        GRB_TRY (GrB_Col_extract (G->in_degree, NULL, NULL, Din, GrB_ALL,
+            ncols, 0, NULL)) ;
+    }
+
+    // convert each 1-by-1 matrix back into an edge weight bound
+    for (int k = 0 ; k <= 1 ; k++)
+    {
+        GrB_Matrix E = (k == 0) ? Emin : Emax ;
+        LAGraph_State state = (LAGraph_State) properties [3+k] ;
+        if (E == NULL || state == LAGraph_STATE_UNKNOWN) continue ;
+        char etype_name [LAGRAPH_MAX_NAME_LEN] ;
+        GrB_Type etype ;
+        LG_TRY (LAGraph_Matrix_TypeName (etype_name, E, msg)) ;
+        LG_TRY (LAGraph_TypeFromName (&etype, etype_name, msg)) ;
+        GrB_Scalar s = NULL ;
+        GRB_TRY (GrB_Scalar_new (&s, etype)) ;
+        if (k == 0)
+        {
+            G->emin = s ;
+            G->emin_state = state ;
+        }
+        else
+        {
+            G->emax = s ;
+            G->emax_state = state ;
+        }
+        GrB_Index nvals ;
+        GRB_TRY (GrB_Matrix_nvals (&nvals, E)) ;
+        if (nvals > 0)
+        {
+            GRB_TRY (GrB_Matrix_extractElement_Scalar (s, E, 0, 0)) ;
+        }
+    }
+
+    // get the BFS push/pull thresholds
+    if (Bfs != NULL)
+    {
+        GrB_Index bnrows, bncols ;
+        GRB_TRY (GrB_Matrix_nrows (&bnrows, Bfs)) ;
+        GRB_TRY (GrB_Matrix_ncols (&bncols, Bfs)) ;
+        LG_ASSERT_MSG (bnrows == 1 && bncols == 3, LAGRAPH_IO_ERROR,
+            "invalid file: BFS thresholds") ;
+        double bfs [3] ;
+        for (int k = 0 ; k < 3 ; k++)
+        {
+            bfs [k] = LAGRAPH_UNKNOWN ;
+            GRB_TRY (GrB_Matrix_extractElement_FP64 (&(bfs [k]), Bfs, 0, k)) ;
+            LG_ASSERT_MSG (bfs [k] > 0 || bfs [k] == LAGRAPH_UNKNOWN,
+                GrB_INVALID_VALUE, "invalid file: BFS thresholds") ;
+        }
+        G->bfs_alpha = bfs [0] ;
+        G->bfs_beta1 = bfs [1] ;
+        G->bfs_beta2 = bfs [2] ;
+    }
+
+    // get the triangle counting method and presort
+    if (Tc != NULL)
+    {
+        GrB_Index tnrows, tncols ;
+        GRB_TRY (GrB_Matrix_nrows (&tnrows, Tc)) ;
+        GRB_TRY (GrB_Matrix_ncols (&tncols, Tc)) ;
+        LG_ASSERT_MSG (tnrows == 1 && tncols == 2, LAGRAPH_IO_ERROR,
+            "invalid file: triangle counting method") ;
+        int64_t method = LAGRAPH_UNKNOWN ;
+        int64_t presort = LAGr_TriangleCount_AutoSort ;
+        GRB_TRY (GrB_Matrix_extractElement_INT64 (&method, Tc, 0, 0)) ;
+        GRB_TRY (GrB_Matrix_extractElement_INT64 (&presort, Tc, 0, 1)) ;
+        LG_ASSERT_MSG (
+            method >= LAGr_TriangleCount_Burkhardt &&
+            method <= LAGr_TriangleCount_Intersect &&
+            presort >= LAGr_TriangleCount_Descending &&
+            presort <= LAGr_TriangleCount_NoSort,
+            GrB_INVALID_VALUE, "invalid file: triangle counting method") ;
+        G->tc_method = (int) method ;
+        G->tc_presort = (int) presort ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the graph, free workspace, and return result
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_FREE_WORK ;
+    (*G_handle) = G ;
+    (*collection_handle) = collection ;
+    return (GrB_SUCCESS) ;
+}
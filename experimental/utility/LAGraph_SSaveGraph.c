@@ -0,0 +1,256 @@
+//------------------------------------------------------------------------------
+// LAGraph_SSaveGraph: save a graph and its cached properties to a file
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LAGraph_SSaveGraph saves a graph G to a *.lagraph file, including all of
+// its cached properties that are currently present.  The file uses the same
+// container format as LAGraph_SSaveSet, where each component of the graph is
+// held as a serialized GrB_Matrix with a given name:
+
+//      "A"             G->A
+//      "AT"            G->AT, if present
+//      "out_degree"    G->out_degree as an m-by-1 GrB_INT64 matrix, if present
+//      "in_degree"     G->in_degree as an n-by-1 GrB_INT64 matrix, if present
+//      "emin"          G->emin as a 1-by-1 matrix, if present
+//      "emax"          G->emax as a 1-by-1 matrix, if present
+//      "bfs"           a 1-by-3 GrB_FP64 matrix holding G->bfs_alpha,
+//                      G->bfs_beta1, and G->bfs_beta2, if calibrated
+//      "triangle_count" a 1-by-2 GrB_INT64 matrix holding G->tc_method and
+//                      G->tc_presort, if calibrated
+//      "properties"    a 1-by-LAGRAPH_SGRAPH_NPROPERTIES GrB_INT64 matrix
+//                      holding the scalar components of G: G->kind,
+//                      G->is_symmetric_structure, G->nself_edges,
+//                      G->emin_state, and G->emax_state, in that order.
+
+// Use LAGraph_SLoadGraph to load the graph back in from the file.  The graph
+// is then ready for use, with no need to recompute G->AT or the degrees.
+// If using SuiteSparse:GraphBLAS, the highest level of compression is used
+// (LZ4HC:9).
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    if (f != NULL) fclose (f) ;                     \
+    f = NULL ;                                      \
+    GrB_free (&desc) ;                              \
+    for (int k = 0 ; k < LAGRAPH_SGRAPH_MAX_ITEMS ; k++) \
+    {                                               \
+        GrB_free (&(Temp [k])) ;                    \
+    }                                               \
+    LAGraph_SFreeContents (&Contents, nitems) ;     \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LAGraph_SSaveGraph
+//------------------------------------------------------------------------------
+
+int LAGraph_SSaveGraph          // save a graph to a *.lagraph file
+(
+    // inputs:
+    char *filename,             // name of file to write to
+    LAGraph_Graph G,            // graph to save, with its cached properties
+    char *collection,           // name of the graph
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    FILE *f = NULL ;
+    LAGraph_Contents *Contents = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int nitems = 0 ;
+    GrB_Matrix Temp [LAGRAPH_SGRAPH_MAX_ITEMS] ;
+    for (int k = 0 ; k < LAGRAPH_SGRAPH_MAX_ITEMS ; k++) Temp [k] = NULL ;
+
+    LG_ASSERT (filename != NULL && collection != NULL, GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    #if LAGRAPH_SUITESPARSE
+    GRB_TRY (GrB_Descriptor_new (&desc)) ;
+    GRB_TRY (GxB_set (desc, GxB_COMPRESSION, GxB_COMPRESSION_LZ4HC + 9)) ;
+    #endif
+
+    //--------------------------------------------------------------------------
+    // gather the components of the graph as a set of matrices
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix Set [LAGRAPH_SGRAPH_MAX_ITEMS] ;
+    const char *Name [LAGRAPH_SGRAPH_MAX_ITEMS] ;
+    GrB_Index nrows, ncols ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, G->A)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, G->A)) ;
+
+    // the scalar components of G
+    int64_t properties [LAGRAPH_SGRAPH_NPROPERTIES] ;
+    properties [0] = (int64_t) G->kind ;
+    properties [1] = (int64_t) G->is_symmetric_structure ;
+    properties [2] = (int64_t) G->nself_edges ;
+    properties [3] = (int64_t) ((G->emin == NULL) ? LAGRAPH_UNKNOWN :
+        G->emin_state) ;
+    properties [4] = (int64_t) ((G->emax == NULL) ? LAGRAPH_UNKNOWN :
+        G->emax_state) ;
+    GRB_TRY (GrB_Matrix_new (&(Temp [nitems]), GrB_INT64, 1,
+        LAGRAPH_SGRAPH_NPROPERTIES)) ;
+    for (int k = 0 ; k < LAGRAPH_SGRAPH_NPROPERTIES ; k++)
+    {
+        GRB_TRY (GrB_Matrix_setElement_INT64 (Temp [nitems], properties [k],
+            0, k)) ;
+    }
+    Set  [nitems] = Temp [nitems] ;
+    Name [nitems++] = "properties" ;
+
+    // the adjacency matrix and its transpose
+    Set  [nitems] = G->A ;
+    Name [nitems++] = "A" ;
+    if (G->AT != NULL)
+    {
+        Set  [nitems] = G->AT ;
+        Name [nitems++] = "AT" ;
+    }
+
+    // the degree vectors, each held as a single-column matrix
+    if (G->out_degree != NULL)
+    {
+        GRB_TRY (GrB_Matrix_new (&(Temp [nitems]), GrB_INT64, nrows, 1)) ;
+        GRB_TRY (GrB_Col_assign (Temp [nitems], NULL, NULL, G->out_degree,
+            GrB_ALL, nrows, 0, NULL)) ;
+        Set  [nitems] = Temp [nitems] ;
+        Name [nitems++] = "out_degree" ;
+    }
+    if (G->in_degree != NULL)
+    {
+        GRB_TRY (GrB_Matrix_new (&(Temp [nitems]), GrB_INT64, ncols, 1)) ;
+        GRB_TRY (GrB_Col_assign (Temp [nitems], NULL, NULL, G->in_degree,
+            GrB_ALL, ncols, 0, NULL)) ;
+        Set  [nitems] = Temp [nitems] ;
+        Name [nitems++] = "in_degree" ;
+    }
+
+    // the edge weight bounds, each held as a 1-by-1 matrix
+    for (int k = 0 ; k <= 1 ; k++)
+    {
+        GrB_Scalar s = (k == 0) ? G->emin : G->emax ;
+        if (s == NULL) continue ;
+        char stype_name [LAGRAPH_MAX_NAME_LEN] ;
+        GrB_Type stype ;
+        LG_TRY (LAGraph_Scalar_TypeName (stype_name, s, msg)) ;
+        LG_TRY (LAGraph_TypeFromName (&stype, stype_name, msg)) ;
+        GRB_TRY (GrB_Matrix_new (&(Temp [nitems]), stype, 1, 1)) ;
+        GRB_TRY (GrB_Matrix_assign_Scalar (Temp [nitems], NULL, NULL, s,
+            GrB_ALL, 1, GrB_ALL, 1, NULL)) ;
+        Set  [nitems] = Temp [nitems] ;
+        Name [nitems++] = (k == 0) ? "emin" : "emax" ;
+    }
+
+    // the BFS push/pull thresholds, held as a 1-by-3 matrix
+    if (G->bfs_alpha > 0 || G->bfs_beta1 > 0 || G->bfs_beta2 > 0)
+    {
+        double bfs [3] = { G->bfs_alpha, G->bfs_beta1, G->bfs_beta2 } ;
+        GRB_TRY (GrB_Matrix_new (&(Temp [nitems]), GrB_FP64, 1, 3)) ;
+        for (int k = 0 ; k < 3 ; k++)
+        {
+            GRB_TRY (GrB_Matrix_setElement_FP64 (Temp [nitems], bfs [k],
+                0, k)) ;
+        }
+        Set  [nitems] = Temp [nitems] ;
+        Name [nitems++] = "bfs" ;
+    }
+
+    // the triangle counting method and presort, held as a 1-by-2 matrix
+    if (G->tc_method > 0)
+    {
+        GRB_TRY (GrB_Matrix_new (&(Temp [nitems]), GrB_INT64, 1, 2)) ;
+        GRB_TRY (GrB_Matrix_setElement_INT64 (Temp [nitems],
+            (int64_t) G->tc_method, 0, 0)) ;
+        GRB_TRY (GrB_Matrix_setElement_INT64 (Temp [nitems],
+            (int64_t) G->tc_presort, 0, 1)) ;
+        Set  [nitems] = Temp [nitems] ;
+        Name [nitems++] = "triangle_count" ;
+    }
+
+    //--------------------------------------------------------------------------
+    // serialize all the matrices
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Calloc ((void **) &Contents, nitems,
+        sizeof (LAGraph_Contents), msg)) ;
+
+    for (int i = 0 ; i < nitems ; i++)
+    {
+        #if LAGRAPH_SUITESPARSE
+        {
+            GRB_TRY (GxB_Matrix_serialize (&(Contents [i].blob),
+                (GrB_Index *) &(Contents [i].blob_size), Set [i], desc)) ;
+        }
+        #else
+        {
+            GrB_Index estimate ;
+            GRB_TRY (GrB_Matrix_serializeSize (&estimate, Set [i])) ;
+            Contents [i].blob_size = estimate ;
+            LG_TRY (LAGraph_Malloc ((void **) &(Contents [i].blob),
+                estimate, sizeof (uint8_t), msg)) ;
+            GRB_TRY (GrB_Matrix_serialize (Contents [i].blob,
+                (GrB_Index *) &(Contents [i].blob_size), Set [i])) ;
+            LG_TRY (LAGraph_Realloc ((void **) &(Contents [i].blob),
+                (size_t) Contents [i].blob_size,
+                estimate, sizeof (uint8_t), msg)) ;
+        }
+        #endif
+    }
+
+    //--------------------------------------------------------------------------
+    // write the header and all the blobs
+    //--------------------------------------------------------------------------
+
+    f = fopen (filename, "w") ;
+    LG_ASSERT_MSG (f != NULL, LAGRAPH_IO_ERROR, "unable to create output file") ;
+
+    LG_TRY (LAGraph_SWrite_HeaderStart (f, collection, msg)) ;
+    for (int i = 0 ; i < nitems ; i++)
+    {
+        char typename [LAGRAPH_MAX_NAME_LEN] ;
+        LG_TRY (LAGraph_Matrix_TypeName (typename, Set [i], msg)) ;
+        LG_TRY (LAGraph_SWrite_HeaderItem (f, LAGraph_matrix_kind,
+            Name [i], typename, 0, Contents [i].blob_size, msg)) ;
+    }
+    LG_TRY (LAGraph_SWrite_HeaderEnd (f, msg)) ;
+
+    for (int i = 0 ; i < nitems ; i++)
+    {
+        LG_TRY (LAGraph_SWrite_Item (f, Contents [i].blob,
+            Contents [i].blob_size, msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -711,6 +711,24 @@ struct LAGraph_Graph_struct
             ///< - BOUND: emax >= max(G->A)
             ///< - UNKNOWN: emax is unknown
 
+    double bfs_alpha ;  ///< push-to-pull threshold for the BFS
+    double bfs_beta1 ;  ///< pull-to-push threshold for a growing frontier
+    double bfs_beta2 ;  ///< pull-to-push threshold for a shrinking frontier
+            ///< These are the thresholds of the push/pull heuristic of
+            ///< @sphinxref{LAGr_BreadthFirstSearch}, as calibrated for this
+            ///< graph by @sphinxref{LAGraph_BreadthFirstSearch_Calibrate},
+            ///< or LAGRAPH_UNKNOWN if not calibrated.  If unknown, the defaults
+            ///< (alpha = 8, beta1 = 8, and beta2 = 512) are used.
+
+    int tc_method ;     ///< triangle counting method
+    int tc_presort ;    ///< triangle counting presort
+            ///< These are the LAGr_TriangleCount_Method and
+            ///< LAGr_TriangleCount_Presort selected for this graph by
+            ///< @sphinxref{LAGraph_TriangleCount_Calibrate}, which
+            ///< @sphinxref{LAGr_TriangleCount} uses in place of its AutoMethod
+            ///< and AutoSort heuristics.  If not calibrated, tc_method is
+            ///< LAGRAPH_UNKNOWN and tc_presort is LAGr_TriangleCount_AutoSort.
+
     //@}
 
     // FUTURE: possible future cached properties:
@@ -2056,6 +2074,131 @@ int LAGraph_TriangleCount
     char *msg
 ) ;
 
+/** LAGraph_TriangleCount_Calibrate: selects the fastest method and presort of
+ * @sphinxref{LAGr_TriangleCount} for a particular graph, and caches them in
+ * G->tc_method and G->tc_presort, so that all subsequent triangle counts on G
+ * with the AutoMethod and AutoSort settings use them.  The Sandia_LL,
+ * Sandia_UU, Sandia_LUT, Sandia_ULT, and Intersect methods are each timed
+ * with and without a presort, on the subgraph induced by a random sample of
+ * nodes.  G->nself_edges and G->out_degree are computed if not already
+ * cached.  Nothing is done if the method is already cached.  This is a Basic
+ * algorithm: G is modified.
+ *
+ * @param[in,out] G         graph to calibrate, which must be undirected, or
+ *                          directed but with a symmetric structure, with no
+ *                          self-edges.
+ * @param[in]     nsamples  # of nodes in the sample.  If zero or less, a
+ *                          default is used.  If nsamples >= n, the whole
+ *                          graph is used.
+ * @param[in]     seed      random number seed, for selecting the sample.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G is NULL.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @retval LAGRAPH_NO_SELF_EDGES_ALLOWED if G has any self-edges.
+ * @retval LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED if G is directed with an
+ *      unsymmetric G->A matrix.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_TriangleCount_Calibrate
+(
+    // input/output:
+    LAGraph_Graph G,
+    // input:
+    int64_t nsamples,
+    uint64_t seed,
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LAGraph_SingleSourceShortestPath
+//------------------------------------------------------------------------------
+
+/** LAGraph_SingleSourceShortestPath: single-source shortest paths, with an
+ * automatic choice of Delta for delta stepping.  This is a Basic algorithm
+ * (G->emin, G->emax, and G->out_degree are computed, if not present).  Delta
+ * is estimated as G->emax divided by the mean out-degree (as sampled by
+ * @sphinxref{LAGr_SampleDegree}), but no smaller than G->emin, and rounded up
+ * to an integer if G->A has an integer type.  If adaptive is true, the width
+ * of each bucket is also adjusted as the method proceeds: buckets that are
+ * empty or quickly settled are widened, and buckets that need many
+ * relaxations of their light edges are narrowed.  The result is the same as
+ * @sphinxref{LAGr_SingleSourceShortestPath}, and the same types of G->A are
+ * supported.
+ *
+ * @param[out] path_length  path_length (i) is the length of the shortest
+ *     path from the source node to node i.  The path_length vector is dense.
+ *     If node (i) is not reachable from the src node, then path_length (i) is
+ *     set to INFINITY for GrB_FP32 and FP32, or the maximum integer for
+ *     GrB_INT32, INT64, UINT32, or UINT64.
+ * @param[in,out] G     input graph; cached properties may be computed.
+ * @param[in] src       source node.
+ * @param[in] adaptive  if true, adapt the bucket width between buckets.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or path_length are NULL.
+ * @retval GrB_INVALID_INDEX if src is invalid.
+ * @retval GrB_NOT_IMPLEMENTED if the type is not supported.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_SingleSourceShortestPath
+(
+    // output:
+    GrB_Vector *path_length,
+    // input/output:
+    LAGraph_Graph G,
+    // input:
+    GrB_Index src,
+    bool adaptive,              // if true, adapt Delta between buckets
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LAGraph_Betweenness: exact betweenness centrality
+//------------------------------------------------------------------------------
+
+/** LAGraph_Betweenness: exact betweeness centrality metric of all nodes in the
+ * graph, using all nodes as sources.  This is a Basic algorithm (G->AT is
+ * computed, if not present).  The sources are processed in batches with
+ * @sphinxref{LAGr_Betweenness}, and the results are summed.  The batch size
+ * is chosen so that the workspace of all batches in progress is about
+ * memory_budget bytes, or 64 sources per batch if memory_budget is zero.  If
+ * the outer number of threads (see @sphinxref{LAGraph_SetNumThreads}) is
+ * greater than one, that many batches are computed in parallel.
+ *
+ * @param[out] centrality   centrality(i) is the metric for node i.
+ * @param[in,out] G     input graph; G->AT may be computed.
+ * @param[in] memory_budget workspace limit, in bytes (zero for the default).
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or centrality are NULL.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Betweenness
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): betweeness centrality of i
+    // input/output:
+    LAGraph_Graph G,            // input graph
+    // input:
+    size_t memory_budget,       // workspace limit in bytes (0: default)
+    char *msg
+) ;
+
 //==============================================================================
 // LAGraph Advanced algorithms and utilities
 //==============================================================================
@@ -2187,6 +2330,54 @@ int LAGr_SampleDegree
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGr_MMRead: read a matrix in MatrixMarket format, in parallel
+//------------------------------------------------------------------------------
+
+/** LAGr_MMRead: reads a matrix in MatrixMarket format.  LAGr_MMRead is
+ * identical to @sphinxref{LAGraph_MMRead}, except that it can read the
+ * entries of a "coordinate" file in large blocks, instead of one line at a
+ * time.  Each block is split at line boundaries and the entries are parsed in
+ * parallel, and GrB_Matrix_build is called just once, after the whole file has
+ * been read.  The matrix returned is identical to the one returned by
+ * LAGraph_MMRead, including the expansion of symmetric, skew-symmetric, and
+ * pattern matrices, and the same error conditions are reported.  The header
+ * of the file, and the entries of an "array" file, are always read one line
+ * at a time.
+ *
+ * The block is doubled in size if it cannot hold a single line of the file,
+ * so any blocksize > 0 is valid.  A blocksize of a few megabytes per thread
+ * is typically sufficient.  LAGraph_MMRead (&A, f, msg) is the same as
+ * LAGr_MMRead (&A, f, 0, msg).
+ *
+ * @param[out] A        handle of the matrix to create.
+ * @param[in,out]  f    handle to an open file to read from.
+ * @param[in] blocksize if zero, the file is read one line at a time.
+ *                      Otherwise, the entries of a coordinate file are read
+ *                      in blocks of this many bytes.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if A or f are NULL.
+ * @retval LAGRAPH_IO_ERROR if the file could not
+ *      be read or contains a matrix with an invalid Matrix Market format.
+ * @retval GrB_NOT_IMPLEMENTED if the type is not supported.  Complex types
+ *      (GxB_FC32 and GxB_FC64 in SuiteSparse:GraphBLAS) are not yet supported.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_MMRead
+(
+    // output:
+    GrB_Matrix *A,      // handle of matrix to create
+    // input:
+    FILE *f,            // file to read from, already open
+    size_t blocksize,   // # of bytes to read at a time, or 0 to read the
+                        // file one line at a time
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGr_BreadthFirstSearch: breadth-first search
 //------------------------------------------------------------------------------
@@ -2236,6 +2427,83 @@ int LAGr_BreadthFirstSearch
     char *msg
 ) ;
 
+/** LAGr_BreadthFirstSearch_Report: breadth-first search of a graph, identical
+ * to @sphinxref{LAGr_BreadthFirstSearch}, except that it also reports which
+ * direction was used to compute each level of the BFS.  This is an Advanced
+ * algorithm, with the same requirements as LAGr_BreadthFirstSearch.
+ *
+ * @param[out]    level      same as LAGr_BreadthFirstSearch.
+ * @param[out]    parent     same as LAGr_BreadthFirstSearch.
+ * @param[out]    direction  a GrB_BOOL vector of size nlevels+1, where
+ *                           nlevels is the largest level of any node reached.
+ *                           direction(k) is true if level k was computed with
+ *                           a pull step, or false if it was computed with a
+ *                           push step, for k = 1 to nlevels.  direction(0) is
+ *                           not present.  All levels are computed with a push
+ *                           step if a vanilla GraphBLAS library is used.
+ * @param[in]     G          The graph, directed or undirected.
+ * @param[in]     src        The index of the src node (0-based)
+ * @param[in,out] msg        any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_INVALID_INDEX if src is invalid.
+ * @retval GrB_NULL_POINTER if direction is NULL, if both level and parent are
+ *      NULL, or if G is NULL.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_BreadthFirstSearch_Report
+(
+    // output:
+    GrB_Vector *level,
+    GrB_Vector *parent,
+    GrB_Vector *direction,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    char *msg
+) ;
+
+/** LAGraph_BreadthFirstSearch_Calibrate: calibrates the thresholds of the
+ * push/pull heuristic of @sphinxref{LAGr_BreadthFirstSearch} for a particular
+ * graph, and caches them in G->bfs_alpha, G->bfs_beta1, and G->bfs_beta2, so
+ * that all subsequent BFS calls on G use them.  An initial guess of the
+ * thresholds is made from the mean and median degree of the graph, as
+ * estimated by @sphinxref{LAGr_SampleDegree}.  This guess is then refined by
+ * timing a short probe run of a few searches from randomly chosen sources,
+ * with a few candidate settings.  G->out_degree (and G->AT, if G is directed
+ * and its structure is not known to be symmetric) are computed if not already
+ * cached, since they are required for the push/pull method.  Nothing is done
+ * if the thresholds are already cached.  If a vanilla GraphBLAS library is
+ * used, the BFS is push-only, and the thresholds are set to their defaults.
+ * This is a Basic algorithm: G is modified.
+ *
+ * @param[in,out] G         graph to calibrate.
+ * @param[in]     nprobes   # of sources for each probe run (at least 1).
+ * @param[in]     seed      random number seed, for selecting the sources.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G is NULL.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_BreadthFirstSearch_Calibrate
+(
+    // input/output:
+    LAGraph_Graph G,
+    // input:
+    int64_t nprobes,
+    uint64_t seed,
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGr_ConnectedComponents: connected components of an undirected graph
 //------------------------------------------------------------------------------
@@ -2288,7 +2556,11 @@ int LAGr_ConnectedComponents
  *     GrB_INT32, INT64, UINT32, or UINT64.
  * @param[in] G         input graph.
  * @param[in] src       source node.
- * @param[in] Delta     for delta stepping.
+ * @param[in] Delta     for delta stepping.  See
+ *      @sphinxref{LAGraph_SingleSourceShortestPath} for a Basic algorithm that
+ *      selects Delta automatically, and
+ *      @sphinxref{LAGr_SingleSourceShortestPath_Parent} to also compute the
+ *      shortest path tree.
  * @param[in,out] msg   any error messages.
  *
  * @retval GrB_SUCCESS if successful.
@@ -2301,9 +2573,6 @@ int LAGr_ConnectedComponents
  * @returns any GraphBLAS errors that may have been encountered.
  */
 
-// FUTURE: add a Basic algorithm that computes G->emin, G->emax, and then uses
-// that information to compute an appropriate (estimated) Delta.
-
 LAGRAPH_PUBLIC
 int LAGr_SingleSourceShortestPath
 (
@@ -2316,6 +2585,54 @@ int LAGr_SingleSourceShortestPath
     char *msg
 ) ;
 
+/** LAGr_SingleSourceShortestPath_Parent: single-source shortest paths, and a
+ * shortest path tree.  This is identical to
+ * @sphinxref{LAGr_SingleSourceShortestPath}, except that it also returns the
+ * parent vector of a tree of shortest paths.  The tree is found once the path
+ * lengths are known, from the edges (i,j) with path_length (i) + A(i,j) ==
+ * path_length (j).  If the graph has only positive edge weights (G->emin is
+ * known and positive), parent (j) is the smallest such i.  Otherwise the tree
+ * is found with a breadth-first search of these edges, since they may contain
+ * zero-weight cycles.  This is an Advanced algorithm (G->emin is required for
+ * best performance).
+ *
+ * @param[out] path_length  path_length (i) is the length of the shortest
+ *     path from the source node to node i, as returned by
+ *     @sphinxref{LAGr_SingleSourceShortestPath}.  If NULL, the path lengths
+ *     are not returned.
+ * @param[out] parent   parent (i) = p if p is the parent of node i in the
+ *     shortest path tree, of type GrB_INT64.  parent (src) = src, and
+ *     parent (i) is not present if node i is not reachable from the src node.
+ *     If NULL, the parent vector is not computed.
+ * @param[in] G         input graph.
+ * @param[in] src       source node.
+ * @param[in] Delta     for delta stepping.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G, Delta, or both path_length and parent are
+ *      NULL.
+ * @retval GrB_INVALID_INDEX if src is invalid.
+ * @retval GrB_EMPTY_OBJECT if Delta does not contain a value.
+ * @retval GrB_NOT_IMPLEMENTED if the type is not supported.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_SingleSourceShortestPath_Parent
+(
+    // output:
+    GrB_Vector *path_length,
+    GrB_Vector *parent,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGr_Betweenness: betweeness centrality metric
 //------------------------------------------------------------------------------
@@ -2340,9 +2657,8 @@ int LAGr_SingleSourceShortestPath
  * @returns any GraphBLAS errors that may have been encountered.
  */
 
-// FUTURE: create a Basic algorithm that randomly selects source nodes, or
-// computes the exact centrality with all nodes as sources (which is very
-// costly).
+// FUTURE: create a Basic algorithm that randomly selects source nodes.  See
+// LAGraph_Betweenness for the exact centrality, with all nodes as sources.
 
 
 LAGRAPH_PUBLIC
@@ -2357,6 +2673,47 @@ int LAGr_Betweenness
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGr_EdgeBetweenness: edge betweeness centrality metric
+//------------------------------------------------------------------------------
+
+/** LAGr_EdgeBetweenness: edge betweeness centrality metric.  This method
+ * computes an approximation of the betweeness-centrality metric of all edges
+ * in the graph, using the same batched breadth-first searches from the given
+ * source nodes as @sphinxref{LAGr_Betweenness}.  The centrality of the edge
+ * (i,j) is the sum, over all sources s and all nodes t, of the fraction of
+ * shortest paths from s to t that traverse the edge.  If G is undirected,
+ * each edge is counted in both directions, and the result is symmetric.  This
+ * is an Advanced algorithm (G->AT is required).
+ *
+ * @param[out] centrality   centrality(i,j) is the metric for the edge (i,j);
+ *                      it has the same structure as G->A.
+ * @param[in] G         input graph.
+ * @param[in] sources   source vertices to compute shortest paths, size ns
+ * @param[in] ns        number of source vertices.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G, centrality, and/our sources are NULL.
+ * @retval GrB_INVALID_INDEX if any source node is invalid.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_EdgeBetweenness
+(
+    // output:
+    GrB_Matrix *centrality,     // centrality(i,j): centrality of edge (i,j)
+    // input:
+    const LAGraph_Graph G,      // input graph
+    const GrB_Index *sources,   // source vertices to compute shortest paths
+    int32_t ns,                 // number of source vertices
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGr_PageRank: PageRank of a graph.
 //------------------------------------------------------------------------------
@@ -2438,6 +2795,8 @@ typedef enum
     LAGr_TriangleCount_Sandia_UU = 4,   ///< sum (sum ((U * U) .* U))
     LAGr_TriangleCount_Sandia_LUT = 5,  ///< sum (sum ((L * U') .* L))
     LAGr_TriangleCount_Sandia_ULT = 6,  ///< sum (sum ((U * L') .* U))
+    LAGr_TriangleCount_Intersect = 7,   ///< same as Sandia_LUT, but by a
+        ///< merge or galloping set intersection of the sorted rows of L.
 }
 LAGr_TriangleCount_Method ;
 
@@ -2476,6 +2835,10 @@ LAGr_TriangleCount_Presort ;
  *                          presort chosen.  If NULL, the AutoSort is used, and
  *                          the presort method is not reported.  Also see the
  *                          description of the LAGr_TriangleCount_Presort enum.
+ *                          If G->tc_method and G->tc_presort have been
+ *                          cached by
+ *                          @sphinxref{LAGraph_TriangleCount_Calibrate}, they
+ *                          are used for the AutoMethod and AutoSort.
  * @param[in,out] msg       any error messages.
  *
  * @retval GrB_SUCCESS if successful.
@@ -2503,4 +2866,169 @@ int LAGr_TriangleCount
     char *msg
 ) ;
 
+/** LAGr_TriangleCountLocal: count the triangles incident on each node, and
+ * optionally on each edge, of a graph (advanced API).  The same methods and
+ * presort as @sphinxref{LAGr_TriangleCount} are used, with the same masks and
+ * kernels, except that all three nodes of each triangle are counted.  For the
+ * Sandia_* methods, this is about three times the work of
+ * @sphinxref{LAGr_TriangleCount}.  The results are in the original node
+ * ordering, even if the graph is presorted.
+ *
+ * @param[out] ntri_vertex  ntri_vertex(i) is the number of triangles that
+ *                          contain node i.  It is a full GrB_INT64 vector.
+ * @param[out] ntri_edge    if not NULL, ntri_edge(i,j) is the number of
+ *                          triangles that contain the edge (i,j).  It is a
+ *                          symmetric GrB_INT64 matrix with the same structure
+ *                          as G->A.
+ * @param[in]  G            The graph, with the same requirements as for
+ *                          @sphinxref{LAGr_TriangleCount}.
+ * @param[in,out] method    specifies which algorithm to use, and returns
+ *                          the method chosen, as for
+ *                          @sphinxref{LAGr_TriangleCount}.
+ * @param[in,out] presort   controls the presort of the graph, and returns the
+ *                          presort chosen, as for
+ *                          @sphinxref{LAGr_TriangleCount}.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or ntri_vertex are NULL.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @retval LAGRAPH_NO_SELF_EDGES_ALLOWED if G has any self-edges, or if
+ *      G->nself_edges is not computed.
+ * @retval LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED if G is directed with an
+ *      unsymmetric G->A matrix.
+ * @retval LAGRAPH_NOT_CACHED if G->out_degree is not present in G.
+ * @retval GrB_INVALID_VALUE method or presort are invalid.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_TriangleCountLocal
+(
+    // output:
+    GrB_Vector *ntri_vertex,
+    GrB_Matrix *ntri_edge,
+    // input:
+    const LAGraph_Graph G,
+    LAGr_TriangleCount_Method *method,
+    LAGr_TriangleCount_Presort *presort,
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LAGr_KCliqueCount: k-clique counting
+//------------------------------------------------------------------------------
+
+/** LAGr_KCliqueCount: count the cliques of size k in a graph (advanced API).
+ * A k-clique is a set of k nodes that are all pairwise connected, so that a
+ * 3-clique is a triangle.  The graph is sorted by descending degree and
+ * oriented as a directed acyclic graph with L = tril (A,-1), as for
+ * @sphinxref{LAGr_TriangleCount}, and the cliques are counted in parallel by
+ * recursively intersecting the rows of L.  Self-edges are ignored.
+ *
+ * @param[out] ncliques     the number of cliques of size k.
+ * @param[in]  G            The graph, symmetric.  G->out_degree must be
+ *                          present (see @sphinxref{LAGraph_Cached_OutDegree}).
+ * @param[in]  k            the size of the cliques to count (k >= 1).  With
+ *                          k = 1 or 2, the number of nodes or edges of G is
+ *                          returned.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or ncliques are NULL.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @retval LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED if G is directed with an
+ *      unsymmetric G->A matrix.
+ * @retval LAGRAPH_NOT_CACHED if G->out_degree is not present in G.
+ * @retval GrB_INVALID_VALUE if k < 1.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_KCliqueCount
+(
+    // output:
+    uint64_t *ncliques,
+    // input:
+    const LAGraph_Graph G,
+    int k,
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LAGr_TriangleList: triangle listing
+//------------------------------------------------------------------------------
+
+/** LAGr_TriangleList_Function: the callback function for
+ * @sphinxref{LAGr_TriangleList}.  It is passed a chunk of ntri triangles
+ * (I [t], J [t], K [t]), for t = 0 to ntri-1, and the user_data pointer
+ * passed to @sphinxref{LAGr_TriangleList}.  The arrays are overwritten by
+ * the next chunk after the function returns.  It returns zero to continue
+ * the listing, a positive value to stop it, or a negative value to stop it
+ * with an error.
+ */
+
+typedef int (*LAGr_TriangleList_Function)
+(
+    const GrB_Index *I,
+    const GrB_Index *J,
+    const GrB_Index *K,
+    int64_t ntri,
+    void *user_data
+) ;
+
+/** LAGr_TriangleList: list the triangles in a graph (advanced API).  Each
+ * triangle (i,j,k) is listed exactly once, with i > j > k.  The triangles are
+ * written into the buffers I, J, and K, each of size chunk_size, which are
+ * passed to the callback function f each time they are full, and once more
+ * for the last partial chunk.  The listing uses O(e) memory for a graph with
+ * e edges, plus the buffers, so it can stream any number of triangles.  The
+ * number of triangles on each edge is computed with the same masked dot
+ * product as the Sandia_LUT method of @sphinxref{LAGr_TriangleCount}, so the
+ * chunks are filled in parallel, and the triangles are listed in the same
+ * order for any chunk_size and any number of threads.  Self-edges are ignored.
+ *
+ * @param[out] ntriangles   if not NULL, the number of triangles passed to f.
+ * @param[in,out] I         buffer of size chunk_size, for the first node of
+ *                          each triangle.
+ * @param[in,out] J         buffer of size chunk_size, for the second node.
+ * @param[in,out] K         buffer of size chunk_size, for the third node.
+ * @param[in]  chunk_size   the size of the buffers (chunk_size > 0).
+ * @param[in]  f            the callback function; see
+ *                          @sphinxref{LAGr_TriangleList_Function}.
+ * @param[in]  user_data    passed to f, and not accessed otherwise.
+ * @param[in]  G            The graph, symmetric.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful, or if f stopped the listing with a
+ *      positive value.
+ * @retval GrB_NULL_POINTER if G, I, J, K, or f are NULL.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @retval LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED if G is directed with an
+ *      unsymmetric G->A matrix.
+ * @retval GrB_INVALID_VALUE if chunk_size is not positive.
+ * @returns the negative value returned by f, if any, or any GraphBLAS errors
+ *      that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_TriangleList
+(
+    // output:
+    uint64_t *ntriangles,
+    // input/output:
+    GrB_Index *I,
+    GrB_Index *J,
+    GrB_Index *K,
+    // input:
+    int64_t chunk_size,
+    LAGr_TriangleList_Function f,
+    void *user_data,
+    const LAGraph_Graph G,
+    char *msg
+) ;
+
 #endif
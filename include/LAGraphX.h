@@ -260,6 +260,80 @@ void LAGraph_SFreeSet           // free a set of matrices
     GrB_Index nmatrices         // # of matrices in the set
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGraph_SSaveGraph, LAGraph_SLoadGraph: save/load a graph to/from a file
+//------------------------------------------------------------------------------
+
+// LAGraph_SSaveGraph writes a graph to a *.lagraph file, as a set of named
+// serialized matrices: its adjacency matrix and all of its cached properties
+// that are present (G->AT, G->out_degree, G->in_degree, G->emin, G->emax, the
+// BFS thresholds, the triangle counting method, and the scalar properties).
+// LAGraph_SLoadGraph reads it back in, so that the cached properties do not
+// need to be recomputed.
+
+// # of scalar properties held in the "properties" item of the file, and the
+// maximum number of items written by LAGraph_SSaveGraph
+#define LAGRAPH_SGRAPH_NPROPERTIES 5
+#define LAGRAPH_SGRAPH_MAX_ITEMS 9
+
+LAGRAPH_PUBLIC
+int LAGraph_SSaveGraph          // save a graph to a *.lagraph file
+(
+    // inputs:
+    char *filename,             // name of file to write to
+    LAGraph_Graph G,            // graph to save, with its cached properties
+    char *collection,           // name of the graph
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LAGraph_SLoadGraph          // load a graph from a *.lagraph file
+(
+    // input:
+    char *filename,             // name of file to read; NULL for stdin
+    // outputs:
+    LAGraph_Graph *G_handle,    // graph loaded from the file
+    char **collection_handle,   // name of the graph
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LAGraph_BinRead, LAGraph_BinWrite: binary *.grb files
+//------------------------------------------------------------------------------
+
+// A *.grb file holds a single matrix, as a raw dump of the internal arrays of
+// a SuiteSparse:GraphBLAS matrix.  It starts with an ASCII header of
+// LAGRAPH_BIN_HEADER bytes that can be inspected with the "head" command.
+// These files are much faster to read than Matrix Market files, but they are
+// not portable across systems with a different endianness.  Both methods
+// require SuiteSparse:GraphBLAS, and return GrB_NOT_IMPLEMENTED otherwise.
+
+#define LAGRAPH_BIN_HEADER 512
+
+LAGRAPH_PUBLIC
+int LAGraph_BinWrite        // write a matrix to a binary *.grb file
+(
+    // input/output:
+    GrB_Matrix A,           // matrix to write; its content is unpacked,
+                            // written, and packed back into A
+    // input:
+    FILE *f,                // file to write it to, already open
+    const char *comments,   // comments to add to the file, up to 210
+                            // characters in length.  Ignored if NULL.
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LAGraph_BinRead         // read a matrix from a binary *.grb file
+(
+    // output:
+    GrB_Matrix *A,          // matrix read from the file
+    // input:
+    FILE *f,                // file to read it from, already open.  The file
+                            // is mapped into memory with mmap if possible.
+    char *msg
+) ;
+
 //****************************************************************************
 // Algorithms
 //****************************************************************************
@@ -830,6 +904,373 @@ int LAGraph_KCore_Decompose
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// breadth-first search variants
+//------------------------------------------------------------------------------
+
+// LAGraph_MultiSourceBFS computes ns breadth-first searches at once, one from
+// each of the nodes sources [0..ns-1].  Row i of the ns-by-n level and parent
+// matrices holds the result of the BFS from sources [i], in the same form as
+// the level and parent vectors of LAGr_BreadthFirstSearch.  Either level or
+// parent may be NULL, but not both.  G->AT and G->out_degree are used for
+// direction optimization if present.
+
+LAGRAPH_PUBLIC
+int LAGraph_MultiSourceBFS
+(
+    // outputs:
+    GrB_Matrix *level,          // if non-NULL, level (i,j) is the level of
+                                // node j in the BFS from sources [i]
+    GrB_Matrix *parent,         // if non-NULL, parent (i,j) is the parent of
+                                // node j in the BFS from sources [i]
+    // inputs:
+    const LAGraph_Graph G,      // input graph
+    const GrB_Index *sources,   // source nodes of each BFS
+    int64_t ns,                 // # of source nodes
+    char *msg
+) ;
+
+// LAGraph_BidirectionalBFS finds the # of edges on a shortest path from src
+// to dest (or -1 if dest is not reachable), and optionally the path itself,
+// as a vector of size distance+1.  It alternates between a forward BFS from
+// src and a backward BFS from dest, always advancing the smaller frontier, and
+// stops as soon as they meet.  G->AT is required if G is directed and its
+// structure is not known to be symmetric.
+
+LAGRAPH_PUBLIC
+int LAGraph_BidirectionalBFS
+(
+    // outputs:
+    int64_t *distance,          // # of edges on a shortest path from src to
+                                // dest, or -1 if dest is not reachable
+    GrB_Vector *path,           // if non-NULL, path (k) is the kth node on a
+                                // shortest path from src to dest
+    // inputs:
+    const LAGraph_Graph G,      // input graph
+    GrB_Index src,              // source node
+    GrB_Index dest,             // destination node
+    char *msg
+) ;
+
+// LAGraph_KHopNeighborhood finds all nodes within k hops of any of the seed
+// nodes, with a BFS that stops after k levels.  The level vector holds the #
+// of hops to each node in the neighborhood.  If subgraph is not NULL, the
+// m-by-m subgraph of G->A induced by the m nodes in the neighborhood is also
+// returned, with its rows and columns in the same order as the entries in
+// level.
+
+LAGRAPH_PUBLIC
+int LAGraph_KHopNeighborhood
+(
+    // outputs:
+    GrB_Vector *level,          // level (i) = # of hops from the seeds to
+                                // node i, for all nodes within k hops
+    GrB_Matrix *subgraph,       // if non-NULL, the subgraph of G->A induced
+                                // by the nodes in the neighborhood
+    // inputs:
+    const LAGraph_Graph G,      // input graph
+    const GrB_Index *seeds,     // seed nodes
+    int64_t nseeds,             // # of seed nodes
+    int64_t k,                  // maximum # of hops
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// shortest path variants
+//------------------------------------------------------------------------------
+
+// LAGraph_MultiSourceSSSP computes ns single-source shortest path problems at
+// once, one from each of the nodes sources [0..ns-1], by delta stepping.  G->A
+// is split into its light and heavy edges once for all the sources, and the
+// buckets are shared across all the sources.  Row i of the dense ns-by-n
+// path_length matrix holds the path lengths from sources [i], in the same form
+// as the path_length vector of LAGr_SingleSourceShortestPath.
+
+LAGRAPH_PUBLIC
+int LAGraph_MultiSourceSSSP
+(
+    // output:
+    GrB_Matrix *path_length,    // path_length (i,j) is the length of the
+                                // shortest path from sources [i] to node j
+    // inputs:
+    const LAGraph_Graph G,      // input graph, not modified
+    const GrB_Index *sources,   // source nodes
+    int64_t ns,                 // # of source nodes
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+) ;
+
+// LAGraph_PointToPointSSSP finds the length of the shortest path from src to
+// dest by delta stepping, stopping once no unsettled node can lead to a
+// shorter path to dest.  If h is not NULL, it is an A* search: h(j) is a lower
+// bound on the length of the shortest path from j to dest (missing entries
+// are zero), which must be consistent.  Nodes with t(j)+h(j) at least the
+// best path length found so far are pruned.  Edge weights must be known to be
+// non-negative (via G->emin) for the early exit; otherwise h is ignored and
+// the full problem is solved.
+
+LAGRAPH_PUBLIC
+int LAGraph_PointToPointSSSP
+(
+    // output:
+    double *path_length,        // length of the shortest path from src to
+                                // dest, or INFINITY if dest is not reachable
+    // inputs:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Index src,              // source node
+    GrB_Index dest,             // target node
+    GrB_Scalar Delta,           // delta value for delta stepping
+    GrB_Vector h,               // optional lower bound on the path length from
+                                // each node to dest (may be NULL)
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// PageRank variants
+//------------------------------------------------------------------------------
+
+// LAGraph_PersonalizedPageRank_Batch computes k personalized PageRanks at
+// once, with a single GrB_mxm with G->AT per iteration.  Column j of the
+// n-by-k matrix P is the (typically sparse) personalization vector of the jth
+// problem; it must be non-negative, and is scaled to sum to one.  Both the
+// teleport and the rank of the sinks are sent to the nodes in P(:,j).  The
+// iterations stop when the change in every column is at most tol, in the
+// 1-norm.  G->AT and G->out_degree are required, as in LAGr_PageRank.
+// LAGraph_PersonalizedPageRank does the same for a single vector p.
+
+LAGRAPH_PUBLIC
+int LAGraph_PersonalizedPageRank_Batch
+(
+    // output:
+    GrB_Matrix *centrality, // centrality(i,j): pagerank of node i, for the
+                            // jth personalization vector
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Matrix P,     // n-by-k matrix of personalization vectors
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LAGraph_PersonalizedPageRank
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Vector p,     // personalization vector of size n
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+) ;
+
+// LAGraph_PageRankIncremental computes the same PageRank as LAGr_PageRank, but
+// starts from a prior centrality r0 (typically the PageRank before a small
+// change to the graph), or from 1/n if r0 is NULL.  If push is false, the
+// power method is used.  If push is true, the sparse residual of r0 is pushed
+// with w'*A on a sparse w, touching only the out-edges of nodes whose residual
+// exceeds tol/n; iters is then the number of push rounds.  The optional nedges
+// is the number of edges traversed.
+
+LAGRAPH_PUBLIC
+int LAGraph_PageRankIncremental
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations (or push rounds) taken
+    GrB_Index *nedges,      // # of edges traversed (optional; may be NULL)
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Vector r0,    // initial centrality (NULL: start at 1/n)
+    bool push,              // if true, use residual propagation
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+) ;
+
+// LAGraph_PageRank_Precision: the precision of LAGraph_PageRankTyped
+typedef enum
+{
+    LAGraph_PageRank_FP32 = 0,  // FP32 vectors and FP32 arithmetic
+    LAGraph_PageRank_FP64 = 1,  // FP64 vectors and FP64 arithmetic
+    LAGraph_PageRank_Mixed = 2, // FP32 vectors, but FP64 arithmetic
+}
+LAGraph_PageRank_Precision ;
+
+// LAGraph_PageRankTyped computes the same PageRank as LAGr_PageRank (or
+// LAGr_PageRankGAP if gap is true), in the given precision.  The centrality
+// has type GrB_FP64 for LAGraph_PageRank_FP64, and GrB_FP32 otherwise.
+
+LAGRAPH_PUBLIC
+int LAGraph_PageRankTyped
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    LAGraph_PageRank_Precision precision,   // FP32, FP64, or mixed
+    bool gap,               // if true, ignore sinks as LAGr_PageRankGAP does
+    double damping,         // damping factor (typically 0.85)
+    double tol,             // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+) ;
+
+// LAGraph_PageRank_Method: the solver used by LAGraph_PageRankSolver
+typedef enum
+{
+    LAGraph_PageRank_Jacobi = 0,        // power method, as in LAGr_PageRank
+    LAGraph_PageRank_GaussSeidel = 1,   // block Gauss-Seidel
+    LAGraph_PageRank_Extrapolated = 2,  // power method with periodic
+                                        // quadratic extrapolation
+}
+LAGraph_PageRank_Method ;
+
+// LAGraph_PageRankSolver computes the same PageRank as LAGr_PageRank, with a
+// choice of solver.  Each iteration is one pass over G->AT, and iters returns
+// the number of passes taken.
+
+LAGRAPH_PUBLIC
+int LAGraph_PageRankSolver
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    LAGraph_PageRank_Method method,     // Jacobi, Gauss-Seidel, or extrapolated
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// approximate betweenness centrality
+//------------------------------------------------------------------------------
+
+// LAGraph_ApproxBetweenness estimates the betweenness centrality of all nodes
+// (on the same scale as LAGraph_Betweenness) from random batches of source
+// nodes, computed with LAGr_Betweenness.  It stops once, with probability at
+// least 1-delta, the error of every node is at most epsilon*n*(n-1), and
+// returns the number of sources sampled in nsamples.  LAGraph_Random_Init
+// must be called first.
+
+LAGRAPH_PUBLIC
+int LAGraph_ApproxBetweenness
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): estimated betweeness of i
+    int64_t *nsamples,          // number of sources sampled
+    // input:
+    const LAGraph_Graph G,      // input graph
+    double epsilon,             // error bound, relative to n*(n-1)
+    double delta,               // probability that the bound fails
+    int32_t batch_size,         // # of sources in each batch (0: default)
+    uint64_t seed,              // random number seed
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// approximate triangle counting
+//------------------------------------------------------------------------------
+
+// LAGraph_ApproxTriangleCount estimates the number of triangles in G by
+// keeping each edge with probability p, counting the triangles that remain,
+// and scaling the count by 1/p^3.  It also returns a conservative confidence
+// interval, of z standard deviations (z = 1.96 for about 95% confidence), with
+// the variance bounded from the largest degree of G rather than estimated from
+// the sample, so the interval does not collapse when the sample has few or no
+// triangles.  The sample depends only on G, p, and the seed.
+
+LAGRAPH_PUBLIC
+int LAGraph_ApproxTriangleCount
+(
+    // output:
+    double *estimate,       // estimated # of triangles in G
+    double *ci_low,         // lower end of the confidence interval
+    double *ci_high,        // upper end of the confidence interval
+    // input:
+    const LAGraph_Graph G,  // input graph
+    double p,               // probability of keeping each edge, in (0,1]
+    double z,               // half-width of the interval, in std. deviations
+    uint64_t seed,          // random number seed
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// incremental connected components
+//------------------------------------------------------------------------------
+
+// An LAGraph_IncrementalCC object holds the connected components of an
+// undirected graph with a fixed set of n nodes, as a forest of parent
+// pointers.  Each root r (with parent [r] == r) is the smallest node in its
+// component, and parent [i] <= i for all nodes i.  LAGraph_IncrementalCC_New
+// constructs the forest from LAGr_ConnectedComponents.  Each call to
+// LAGraph_IncrementalCC_Insert adds a batch of edges, in time proportional to
+// the size of the batch (times the depth of the trees it touches), not the
+// size of the graph.  LAGraph_IncrementalCC_Component returns the components
+// in the same form as LAGr_ConnectedComponents, where component(i) is the
+// smallest node in the component containing node i.
+
+struct LAGraph_IncrementalCC_struct
+{
+    GrB_Index n ;           // # of nodes
+    int64_t *parent ;       // size n, parent [i] is the parent of node i
+    int64_t nrounds ;       // # of rounds of hooking done by the last call to
+                            // LAGraph_IncrementalCC_Insert
+} ;
+
+typedef struct LAGraph_IncrementalCC_struct *LAGraph_IncrementalCC ;
+
+LAGRAPH_PUBLIC
+int LAGraph_IncrementalCC_New
+(
+    // output:
+    LAGraph_IncrementalCC *cc,  // the connected components of G
+    // input:
+    const LAGraph_Graph G,      // input graph (symmetric structure required)
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LAGraph_IncrementalCC_Insert
+(
+    // input/output:
+    LAGraph_IncrementalCC cc,   // connected components, updated on output
+    // input:
+    const GrB_Index *I,         // the edges (I [e], J [e]) are inserted,
+    const GrB_Index *J,         // for e = 0 to nedges-1
+    GrB_Index nedges,
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LAGraph_IncrementalCC_Component
+(
+    // output:
+    GrB_Vector *component,      // component(i)=s if node i is in the
+                                // component whose smallest node is s
+    // input/output:
+    LAGraph_IncrementalCC cc,   // all paths are compressed on output
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LAGraph_IncrementalCC_Delete
+(
+    // input/output:
+    LAGraph_IncrementalCC *cc,  // the object to free; set to NULL on output
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // counting graphlets
 //------------------------------------------------------------------------------
@@ -38,7 +38,7 @@ int LAGr_BreadthFirstSearch
 {
 
 #if LAGRAPH_SUITESPARSE
-    return LG_BreadthFirstSearch_SSGrB   (level, parent, G, src, msg) ;
+    return LG_BreadthFirstSearch_SSGrB (level, parent, NULL, G, src, msg) ;
 #else
     return LG_BreadthFirstSearch_vanilla (level, parent, G, src, msg) ;
 #endif
@@ -0,0 +1,100 @@
+//------------------------------------------------------------------------------
+// LAGr_BreadthFirstSearch_Report:  BFS, with the direction of each level
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// Identical to LAGr_BreadthFirstSearch, except that it also returns a boolean
+// vector, where direction(k) is true if the kth level of the BFS was computed
+// with a pull step, or false if it was computed with a push step.  The vanilla
+// method is always push-only.
+
+// This is an Advanced algorithm, with the same requirements as
+// LAGr_BreadthFirstSearch.
+
+#define LG_FREE_WORK            \
+{                               \
+    GrB_free (&l_level) ;       \
+}
+
+#define LG_FREE_ALL             \
+{                               \
+    LG_FREE_WORK ;              \
+    GrB_free (&dir) ;           \
+    if (parent != NULL) GrB_free (parent) ; \
+}
+
+#include "LG_alg_internal.h"
+
+int LAGr_BreadthFirstSearch_Report
+(
+    // output:
+    GrB_Vector *level,
+    GrB_Vector *parent,
+    GrB_Vector *direction,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    char *msg
+)
+{
+
+    LG_CLEAR_MSG ;
+    GrB_Vector l_level = NULL, dir = NULL ;
+    if (level  != NULL) (*level ) = NULL ;
+    if (parent != NULL) (*parent) = NULL ;
+    LG_ASSERT (direction != NULL, GrB_NULL_POINTER) ;
+    (*direction) = NULL ;
+
+#if LAGRAPH_SUITESPARSE
+    return (LG_BreadthFirstSearch_SSGrB (level, parent, direction, G, src,
+        msg)) ;
+#else
+
+    //--------------------------------------------------------------------------
+    // push-only BFS
+    //--------------------------------------------------------------------------
+
+    LG_ASSERT_MSG (level != NULL || parent != NULL, GrB_NULL_POINTER,
+        "either level or parent must be non-NULL") ;
+
+    // the level is always needed to find the # of levels
+    LG_TRY (LG_BreadthFirstSearch_vanilla (&l_level, parent, G, src, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // all levels were computed with a push step
+    //--------------------------------------------------------------------------
+
+    int64_t nlevels = 0 ;
+    GRB_TRY (GrB_reduce (&nlevels, NULL, GrB_MAX_MONOID_INT64, l_level,
+        NULL)) ;
+    GRB_TRY (GrB_Vector_new (&dir, GrB_BOOL, nlevels + 1)) ;
+    GRB_TRY (GrB_assign (dir, NULL, NULL, (bool) false, GrB_ALL, nlevels + 1,
+        NULL)) ;
+    GRB_TRY (GrB_Vector_removeElement (dir, 0)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    if (level != NULL)
+    {
+        (*level) = l_level ;
+        l_level = NULL ;
+    }
+    (*direction) = dir ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+#endif
+}
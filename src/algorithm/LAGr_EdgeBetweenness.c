@@ -0,0 +1,42 @@
+//------------------------------------------------------------------------------
+// LAGr_EdgeBetweenness: edge betweenness-centrality
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT is required).
+
+// Batch algorithm for computing the betweeness centrality of all edges, from
+// a given set of sources.  The result is an n-by-n matrix with the same
+// structure as G->A, where centrality(i,j) is the centrality of the edge
+// (i,j).  The same batched BFS and backward accumulation as LAGr_Betweenness
+// are used; see LG_Betweenness for details.
+
+#include "LG_alg_internal.h"
+
+int LAGr_EdgeBetweenness
+(
+    // output:
+    GrB_Matrix *centrality,     // centrality(i,j): centrality of edge (i,j)
+    // input:
+    const LAGraph_Graph G,      // input graph
+    const GrB_Index *sources,   // source vertices to compute shortest paths
+    int32_t ns,                 // number of source vertices
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (centrality != NULL, GrB_NULL_POINTER) ;
+    return (LG_Betweenness (NULL, centrality, G, sources, ns, msg)) ;
+}
@@ -0,0 +1,272 @@
+//------------------------------------------------------------------------------
+// LAGr_KCliqueCount: count the cliques of size k in a graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->out_degree and G->is_symmetric_structure
+// are required).
+
+// Given a graph with a symmetric structure, LAGr_KCliqueCount counts the
+// number of cliques of size k, that is, sets of k nodes that are all pairwise
+// connected.  With k = 3, this is the number of triangles.  Self-edges are
+// ignored.
+
+// The graph is first sorted by descending degree with LAGr_SortByDegree, and
+// L = tril (A(P,P),-1) is constructed as for LAGr_TriangleCount.  L is a
+// directed acyclic graph in which each edge is oriented from a node to a
+// neighbor of equal or higher degree, so that each clique has exactly one
+// ordering of its nodes as a path in L, and no row of L has more than about
+// sqrt (2*e) entries, for a graph with e edges.  For each node i, the cliques
+// with i as their first node are counted by recursively intersecting the
+// (sorted) rows of L, starting with the candidates L(i,:):
+
+//      count (C, r) = # of r-cliques in the nodes C
+//                   = |C| if r = 1
+//                   = sum of count (intersect (C(1:j-1), L(C(j),:)), r-1)
+//                     for each C(j) in C, otherwise
+
+// and the total is the sum of count (L(i,:), k-1) for all nodes i.  Since the
+// rows of L are sorted and each row L(v,:) only holds nodes less than v, only
+// the candidates preceding v in C need to be intersected with L(v,:).  The
+// nodes i are distributed over the threads with OpenMP dynamic scheduling, and
+// each thread has its own workspace of size (k-2) times the largest row of L.
+// If no row of L has k-1 or more entries, there are no k-cliques and the
+// search is skipped.
+
+// Reference: Danisch, Balalau, and Sozio, "Listing k-cliques in sparse
+// real-world graphs", WWW'18, https://doi.org/10.1145/3178876.3186125
+
+#define LG_FREE_WORK                        \
+{                                           \
+    GrB_free (&L) ;                         \
+    GrB_free (&T) ;                         \
+    LAGraph_Free ((void **) &P, NULL) ;     \
+    LAGraph_Free ((void **) &Lp, NULL) ;    \
+    LAGraph_Free ((void **) &Lj, NULL) ;    \
+    LAGraph_Free ((void **) &Lx, NULL) ;    \
+    LAGraph_Free ((void **) &W, NULL) ;     \
+}
+
+#define LG_FREE_ALL LG_FREE_WORK
+
+#include "LG_alg_internal.h"
+
+//------------------------------------------------------------------------------
+// kclique_intersect: intersection of two sorted lists
+//------------------------------------------------------------------------------
+
+// c = intersection of a and b.  c must have space for min (na,nb) entries.
+
+static inline int64_t kclique_intersect
+(
+    GrB_Index *c,                       // output list
+    const GrB_Index *a, int64_t na,     // sorted list a, of length na
+    const GrB_Index *b, int64_t nb      // sorted list b, of length nb
+)
+{
+    int64_t pa = 0, pb = 0, nc = 0 ;
+    while (pa < na && pb < nb)
+    {
+        const GrB_Index x = a [pa] ;
+        const GrB_Index y = b [pb] ;
+        // c [nc] is always written, but kept only if x == y
+        c [nc] = x ;
+        nc += (x == y) ;
+        pa += (x <= y) ;
+        pb += (y <= x) ;
+    }
+    return (nc) ;
+}
+
+//------------------------------------------------------------------------------
+// kclique_count: count the r-cliques in a list of candidate nodes
+//------------------------------------------------------------------------------
+
+// W holds (r-1) workspace lists, each of size dmax.
+
+static uint64_t kclique_count
+(
+    const GrB_Index *Lp,        // L in CSR form, with sorted rows
+    const GrB_Index *Lj,
+    const GrB_Index *C,         // sorted list of candidate nodes
+    int64_t nc,                 // # of candidates
+    int r,                      // size of the cliques to count
+    GrB_Index *W,               // workspace
+    int64_t dmax                // size of each workspace list
+)
+{
+    if (r == 1) return ((uint64_t) nc) ;
+    uint64_t count = 0 ;
+    for (int64_t k = r-1 ; k < nc ; k++)
+    {
+        // Cnew = candidates in C(0:k-1) that are also neighbors of v = C(k)
+        const GrB_Index v = C [k] ;
+        int64_t nnew = kclique_intersect (W, C, k, Lj + Lp [v],
+            Lp [v+1] - Lp [v]) ;
+        if (r == 2)
+        {
+            // each node in Cnew completes an edge with v
+            count += (uint64_t) nnew ;
+        }
+        else if (nnew >= r-1)
+        {
+            // count the (r-1)-cliques in Cnew
+            count += kclique_count (Lp, Lj, W, nnew, r-1, W + dmax, dmax) ;
+        }
+    }
+    return (count) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_KCliqueCount: count the cliques of size k in a graph
+//------------------------------------------------------------------------------
+
+int LAGr_KCliqueCount
+(
+    // output:
+    uint64_t *ncliques,         // # of cliques of size k
+    // input:
+    const LAGraph_Graph G,
+    int k,                      // size of the cliques to count (k >= 1)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix L = NULL, T = NULL ;
+    int64_t *P = NULL ;
+    GrB_Index *Lp = NULL, *Lj = NULL, *W = NULL ;
+    void *Lx = NULL ;
+    LG_ASSERT (ncliques != NULL, GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)),
+        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
+        "G->A must be known to be symmetric") ;
+    LG_ASSERT_MSG (G->out_degree != NULL,
+        LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+    LG_ASSERT_MSG (k >= 1, GrB_INVALID_VALUE, "k must be at least 1") ;
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    if (k == 1)
+    {
+        // each node is a clique of size 1
+        (*ncliques) = n ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // L = tril (A(P,P),-1), sorted by descending degree
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGr_SortByDegree (&P, G, true, false, msg)) ;
+    GRB_TRY (GrB_Matrix_new (&T, GrB_BOOL, n, n)) ;
+    GRB_TRY (GrB_extract (T, NULL, NULL, G->A, (GrB_Index *) P, n,
+        (GrB_Index *) P, n, NULL)) ;
+    LG_TRY (LAGraph_Free ((void **) &P, NULL)) ;
+    LG_TRY (LG_tricount_prep (&L, NULL, T, msg)) ;
+    GRB_TRY (GrB_free (&T)) ;
+
+    if (k == 2)
+    {
+        // each edge is a clique of size 2
+        GrB_Index nedges ;
+        GRB_TRY (GrB_Matrix_nvals (&nedges, L)) ;
+        LG_FREE_WORK ;
+        (*ncliques) = nedges ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the contents of L in CSR form, with sorted rows
+    //--------------------------------------------------------------------------
+
+    #if LAGRAPH_SUITESPARSE
+    // unpack L, which is a temporary matrix, without copying it
+    GrB_Index Lp_size, Lj_size, Lx_size ;
+    bool L_iso ;
+    GRB_TRY (GxB_Matrix_unpack_CSR (L, &Lp, &Lj, &Lx, &Lp_size, &Lj_size,
+        &Lx_size, &L_iso, NULL, NULL)) ;
+    #else
+    GrB_Index Lp_len, Lj_len, Lx_len ;
+    GRB_TRY (GrB_Matrix_exportSize (&Lp_len, &Lj_len, &Lx_len, GrB_CSR_FORMAT,
+        L)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Lp, Lp_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Lj, Lj_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc (&Lx, Lx_len, sizeof (bool), msg)) ;
+    GRB_TRY (GrB_Matrix_export (Lp, Lj, (bool *) Lx, &Lp_len, &Lj_len,
+        &Lx_len, GrB_CSR_FORMAT, L)) ;
+    #endif
+
+    // dmax = the largest row of L
+    int64_t dmax = 0 ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        dmax = LAGRAPH_MAX (dmax, (int64_t) (Lp [i+1] - Lp [i])) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the cliques
+    //--------------------------------------------------------------------------
+
+    uint64_t count = 0 ;
+    if (dmax >= k-1)
+    {
+        int nthreads, nthreads_outer, nthreads_inner ;
+        LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner,
+            msg)) ;
+        nthreads = nthreads_outer * nthreads_inner ;
+        nthreads = LAGRAPH_MIN (nthreads, n / 16) ;
+        nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+        // each thread has k-2 workspace lists of size dmax
+        int64_t wsize = (int64_t) (k-2) * dmax ;
+        LG_TRY (LAGraph_Malloc ((void **) &W, nthreads * wsize,
+            sizeof (GrB_Index), msg)) ;
+
+        #pragma omp parallel for num_threads(nthreads) \
+            schedule(dynamic,64) reduction(+:count)
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            #if defined ( _OPENMP )
+            const int tid = omp_get_thread_num ( ) ;
+            #else
+            const int tid = 0 ;
+            #endif
+            // count the k-cliques whose first node is i
+            const int64_t pstart = Lp [i] ;
+            const int64_t pend = Lp [i+1] ;
+            if (pend - pstart >= k-1)
+            {
+                count += kclique_count (Lp, Lj, Lj + pstart, pend - pstart,
+                    k-1, W + tid * wsize, dmax) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    (*ncliques) = count ;
+    return (GrB_SUCCESS) ;
+}
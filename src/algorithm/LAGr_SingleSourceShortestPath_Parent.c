@@ -0,0 +1,42 @@
+//------------------------------------------------------------------------------
+// LAGr_SingleSourceShortestPath_Parent: SSSP with the shortest path tree
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->emin is required for best performance).
+
+// Identical to LAGr_SingleSourceShortestPath, except that it can also return
+// the parent vector of a shortest path tree, so that the paths themselves can
+// be reconstructed.  See LG_SingleSourceShortestPath for details.
+
+#include "LG_alg_internal.h"
+
+int LAGr_SingleSourceShortestPath_Parent
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    GrB_Vector *parent,         // parent (i) is the parent of vertex i in the
+                                // shortest path tree
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Index source,           // source vertex
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+)
+{
+    return (LG_SingleSourceShortestPath (path_length, parent, G, source, Delta,
+        false, msg)) ;
+}
@@ -0,0 +1,44 @@
+//------------------------------------------------------------------------------
+// LAGr_TriangleCountLocal: # of triangles incident on each node and edge
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->nself_edges, G->out_degree,
+// G->is_symmetric_structure are required).
+
+// Count the number of triangles incident on each node, and optionally on each
+// edge, with the same methods and presort as LAGr_TriangleCount.  See
+// LG_TriangleCount for details.
+
+#include "LG_alg_internal.h"
+
+int LAGr_TriangleCountLocal
+(
+    // output:
+    GrB_Vector *ntri_vertex,    // ntri_vertex (i): # triangles with node i
+    GrB_Matrix *ntri_edge,      // ntri_edge (i,j): # triangles with edge (i,j)
+                                // (optional; may be NULL)
+    // input:
+    const LAGraph_Graph G,
+    LAGr_TriangleCount_Method *p_method,
+    LAGr_TriangleCount_Presort *p_presort,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (ntri_vertex != NULL, GrB_NULL_POINTER) ;
+    return (LG_TriangleCount (NULL, ntri_vertex, ntri_edge, G, p_method,
+        p_presort, msg)) ;
+}
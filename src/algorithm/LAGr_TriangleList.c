@@ -0,0 +1,263 @@
+//------------------------------------------------------------------------------
+// LAGr_TriangleList: list the triangles in a graph, in chunks
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->is_symmetric_structure is required).
+
+// LAGr_TriangleList lists each triangle (i,j,k) of a graph with a symmetric
+// structure exactly once, with i > j > k.  The triangles are written into
+// the arrays I, J, and K provided by the caller, each of size chunk_size, and
+// the callback function f is called each time the arrays are full, and once
+// more for the last (partial) chunk (f is not called if G has no triangles).
+// The memory used is O(e) for a graph with e edges, plus the buffers, no
+// matter how many triangles the graph has.  Self-edges are ignored.
+
+// With L = tril (A,-1), the triangle (i,j,k) is found from the edge (i,j) of
+// L, with k in the intersection of L(i,:) and L(j,:).  The number of
+// triangles on each edge is first computed with the masked dot product C<L> =
+// L*L' of the Sandia_LUT method of LAGr_TriangleCount, which has an entry
+// only for the edges of L that are in at least one triangle.  Its cumulative
+// sum gives the position of each triangle in the listing, so that each chunk
+// is filled in parallel (with OpenMP dynamic scheduling over the edges in
+// the chunk) by intersecting the sorted rows of L, and the triangles always
+// appear in the same order, in ascending order of the position of the edge
+// (i,j) in C, for any chunk_size and any number of threads.  The callback is
+// called from a single thread.
+
+// If f returns zero, the listing continues.  If it returns a positive value,
+// the listing stops and LAGr_TriangleList returns GrB_SUCCESS.  If it returns
+// a negative value, the listing stops and that value is returned as an error.
+// On output, ntriangles (if not NULL) is the number of triangles passed to f.
+
+#define LG_FREE_WORK                        \
+{                                           \
+    GrB_free (&C) ;                         \
+    GrB_free (&L) ;                         \
+    LAGraph_Free ((void **) &Lp, NULL) ;    \
+    LAGraph_Free ((void **) &Lj, NULL) ;    \
+    LAGraph_Free ((void **) &Lx, NULL) ;    \
+    LAGraph_Free ((void **) &Cp, NULL) ;    \
+    LAGraph_Free ((void **) &Cj, NULL) ;    \
+    LAGraph_Free ((void **) &Cx, NULL) ;    \
+    LAGraph_Free ((void **) &Ci, NULL) ;    \
+}
+
+#define LG_FREE_ALL LG_FREE_WORK
+
+#include "LG_alg_internal.h"
+
+int LAGr_TriangleList
+(
+    // output:
+    uint64_t *ntriangles,       // # of triangles listed (optional)
+    // input/output:
+    GrB_Index *I,               // buffers of size chunk_size, for the
+    GrB_Index *J,               // triangles (I [t], J [t], K [t])
+    GrB_Index *K,
+    // input:
+    int64_t chunk_size,         // size of I, J, and K
+    LAGr_TriangleList_Function f,   // called for each chunk of triangles
+    void *user_data,            // passed to f
+    const LAGraph_Graph G,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix L = NULL, C = NULL ;
+    GrB_Index *Lp = NULL, *Lj = NULL, *Cp = NULL, *Cj = NULL, *Ci = NULL ;
+    void *Lx = NULL ;
+    int64_t *Cx = NULL ;
+    if (ntriangles != NULL) (*ntriangles) = 0 ;
+    LG_ASSERT (I != NULL && J != NULL && K != NULL && f != NULL,
+        GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (chunk_size > 0, GrB_INVALID_VALUE,
+        "chunk_size must be positive") ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)),
+        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
+        "G->A must be known to be symmetric") ;
+
+    //--------------------------------------------------------------------------
+    // C<L> = L*L', the # of triangles on each edge (i,j) of L with k < j
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    LG_TRY (LG_tricount_prep (&L, NULL, G->A, msg)) ;
+    GRB_TRY (GrB_Matrix_new (&C, GrB_INT64, n, n)) ;
+    #if LAGRAPH_SUITESPARSE
+    GrB_Semiring semiring = GxB_PLUS_PAIR_INT64 ;
+    #else
+    GrB_Semiring semiring = LAGraph_plus_one_int64 ;
+    #endif
+    GRB_TRY (GrB_mxm (C, L, NULL, semiring, L, L, GrB_DESC_ST1)) ;
+
+    //--------------------------------------------------------------------------
+    // get the contents of L and C in CSR form, with sorted rows
+    //--------------------------------------------------------------------------
+
+    #if LAGRAPH_SUITESPARSE
+    // unpack L and C, which are temporary matrices, without copying them
+    GrB_Index Lp_size, Lj_size, Lx_size, Cp_size, Cj_size, Cx_size ;
+    bool L_iso, C_iso ;
+    GRB_TRY (GxB_Matrix_unpack_CSR (L, &Lp, &Lj, &Lx, &Lp_size, &Lj_size,
+        &Lx_size, &L_iso, NULL, NULL)) ;
+    GRB_TRY (GxB_Matrix_unpack_CSR (C, &Cp, &Cj, (void **) &Cx, &Cp_size,
+        &Cj_size, &Cx_size, &C_iso, NULL, NULL)) ;
+    if (C_iso)
+    {
+        // expand the iso value of C
+        GrB_Index Cnz = Cp [n] ;
+        int64_t c = Cx [0] ;
+        LG_TRY (LAGraph_Free ((void **) &Cx, NULL)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Cx, Cnz, sizeof (int64_t), msg)) ;
+        for (int64_t p = 0 ; p < Cnz ; p++)
+        {
+            Cx [p] = c ;
+        }
+    }
+    #else
+    GrB_Index Lp_len, Lj_len, Lx_len, Cp_len, Cj_len, Cx_len ;
+    GRB_TRY (GrB_Matrix_exportSize (&Lp_len, &Lj_len, &Lx_len, GrB_CSR_FORMAT,
+        L)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Lp, Lp_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Lj, Lj_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc (&Lx, Lx_len, sizeof (bool), msg)) ;
+    GRB_TRY (GrB_Matrix_export (Lp, Lj, (bool *) Lx, &Lp_len, &Lj_len,
+        &Lx_len, GrB_CSR_FORMAT, L)) ;
+    GRB_TRY (GrB_Matrix_exportSize (&Cp_len, &Cj_len, &Cx_len, GrB_CSR_FORMAT,
+        C)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Cp, Cp_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Cj, Cj_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Cx, Cx_len, sizeof (int64_t), msg)) ;
+    GRB_TRY (GrB_Matrix_export (Cp, Cj, Cx, &Cp_len, &Cj_len, &Cx_len,
+        GrB_CSR_FORMAT, C)) ;
+    #endif
+    GRB_TRY (GrB_free (&L)) ;
+    GRB_TRY (GrB_free (&C)) ;
+
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, n / 16) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // Ci = row indices of C, and Cx = cumulative sum of Cx
+    //--------------------------------------------------------------------------
+
+    // On output, the triangles on the edge (Ci [p], Cj [p]) are at positions
+    // Cx [p] to Cx [p+1]-1 of the listing.
+
+    GrB_Index Cnz = Cp [n] ;
+    LG_TRY (LAGraph_Malloc ((void **) &Ci, Cnz, sizeof (GrB_Index), msg)) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        for (int64_t p = Cp [i] ; p < Cp [i+1] ; p++)
+        {
+            Ci [p] = i ;
+        }
+    }
+    LG_TRY (LAGraph_Realloc ((void **) &Cx, Cnz + 1, Cnz, sizeof (int64_t),
+        msg)) ;
+    int64_t ntri = 0 ;
+    for (int64_t p = 0 ; p < Cnz ; p++)
+    {
+        int64_t c = Cx [p] ;
+        Cx [p] = ntri ;
+        ntri += c ;
+    }
+    Cx [Cnz] = ntri ;
+
+    //--------------------------------------------------------------------------
+    // list the triangles, one chunk at a time
+    //--------------------------------------------------------------------------
+
+    int64_t pfirst = 0 ;
+    for (int64_t t0 = 0 ; t0 < ntri ; t0 += chunk_size)
+    {
+
+        //----------------------------------------------------------------------
+        // find the edges pfirst:plast-1 with triangles t0 to t1-1
+        //----------------------------------------------------------------------
+
+        int64_t t1 = LAGRAPH_MIN (t0 + chunk_size, ntri) ;
+        while (Cx [pfirst+1] <= t0) pfirst++ ;
+        int64_t plast = pfirst ;
+        while (plast < Cnz && Cx [plast] < t1) plast++ ;
+
+        //----------------------------------------------------------------------
+        // fill the chunk
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,64)
+        for (int64_t p = pfirst ; p < plast ; p++)
+        {
+            // list the triangles (i,j,k) on the edge (i,j), for all k in the
+            // intersection of L(i,:) and L(j,:), which are the triangles
+            // Cx [p] to Cx [p+1]-1 of the listing
+            const GrB_Index i = Ci [p] ;
+            const GrB_Index j = Cj [p] ;
+            const GrB_Index *a = Lj + Lp [i] ;
+            const GrB_Index *b = Lj + Lp [j] ;
+            const int64_t na = Lp [i+1] - Lp [i] ;
+            const int64_t nb = Lp [j+1] - Lp [j] ;
+            int64_t t = Cx [p] ;
+            int64_t pa = 0, pb = 0 ;
+            while (pa < na && pb < nb && t < t1)
+            {
+                const GrB_Index x = a [pa] ;
+                const GrB_Index y = b [pb] ;
+                if (x == y)
+                {
+                    if (t >= t0)
+                    {
+                        I [t - t0] = i ;
+                        J [t - t0] = j ;
+                        K [t - t0] = x ;
+                    }
+                    t++ ;
+                }
+                pa += (x <= y) ;
+                pb += (y <= x) ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // pass the chunk to the callback function
+        //----------------------------------------------------------------------
+
+        int result = f (I, J, K, t1 - t0, user_data) ;
+        LG_ASSERT_MSG (result >= 0, result, "callback function failed") ;
+        if (ntriangles != NULL) (*ntriangles) = t1 ;
+        if (result > 0) break ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,190 @@
+//------------------------------------------------------------------------------
+// LAGraph_Betweenness: exact betweenness centrality, in batches of sources
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// This is a Basic algorithm (G->AT is computed, if not present).
+
+// LAGraph_Betweenness computes the exact betweenness centrality of all nodes,
+// using every node of the graph as a source.  LAGr_Betweenness with ns sources
+// needs several ns-by-n matrices (two of them dense, plus the BFS levels S and
+// the sparse frontier and workspace), so it cannot be used with all n sources
+// at once on a large graph.  Instead, the sources are split into batches, each
+// of which is computed with LAGr_Betweenness, and the results are summed.
+
+// The size of each batch is chosen so that the workspace for all batches in
+// progress fits in memory_budget bytes, estimated as LG_BC_BYTES_PER_ENTRY
+// bytes for each of the ns*n entries of a batch.  If memory_budget is zero, a
+// batch has LG_BC_DEFAULT_BATCH sources.
+
+// If LG_nthreads_outer (see LAGraph_SetNumThreads) is larger than one, that
+// many batches are computed in parallel, each of which uses LG_nthreads_inner
+// threads inside GraphBLAS.  The memory_budget is then shared between the
+// concurrent batches.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &sources, NULL) ;   \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (centrality) ;         \
+}
+
+#include "LG_internal.h"
+
+// estimated workspace per entry of the ns-by-n matrices of LAGr_Betweenness
+#define LG_BC_BYTES_PER_ENTRY 64
+
+// batch size if no memory_budget is given
+#define LG_BC_DEFAULT_BATCH 64
+
+int LAGraph_Betweenness
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): betweeness centrality of i
+    // input/output:
+    LAGraph_Graph G,            // input graph
+    // input:
+    size_t memory_budget,       // workspace limit in bytes (0: default)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *sources = NULL ;
+    LG_ASSERT (centrality != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // compute G->AT, if needed
+    //--------------------------------------------------------------------------
+
+    if (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure != LAGraph_TRUE)
+    {
+        LG_TRY (LAGraph_Cached_AT (G, msg)) ;
+    }
+
+    // G->A and G->AT are used by many user threads at the same time, so any
+    // pending work must be finished first
+    GRB_TRY (GrB_Matrix_wait (G->A, GrB_MATERIALIZE)) ;
+    if (G->AT != NULL)
+    {
+        GRB_TRY (GrB_Matrix_wait (G->AT, GrB_MATERIALIZE)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the batch size
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Vector_new (centrality, GrB_FP64, n)) ;
+    GRB_TRY (GrB_assign (*centrality, NULL, NULL, (double) 0, GrB_ALL, n,
+        NULL)) ;
+    if (n == 0)
+    {
+        return (GrB_SUCCESS) ;
+    }
+
+    int nthreads = LAGRAPH_MAX (LG_nthreads_outer, 1) ;
+    int64_t ns ;
+    if (memory_budget == 0)
+    {
+        ns = LG_BC_DEFAULT_BATCH ;
+    }
+    else
+    {
+        ns = (int64_t) (memory_budget /
+            ((double) nthreads * LG_BC_BYTES_PER_ENTRY * (double) n)) ;
+    }
+    ns = LAGRAPH_MAX (ns, 1) ;
+    ns = LAGRAPH_MIN (ns, (int64_t) n) ;
+    ns = LAGRAPH_MIN (ns, INT32_MAX) ;
+    int64_t nbatches = ((int64_t) n + ns - 1) / ns ;
+    nthreads = (int) LAGRAPH_MIN (nthreads, nbatches) ;
+
+    // sources = 0:n-1
+    LG_TRY (LAGraph_Malloc ((void **) &sources, n, sizeof (GrB_Index), msg)) ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        sources [i] = i ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compute each batch and sum up the results
+    //--------------------------------------------------------------------------
+
+    int status = GrB_SUCCESS ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (int64_t b = 0 ; b < nbatches ; b++)
+    {
+        // skip the remaining batches if any batch has failed
+        int batch_status ;
+        #pragma omp atomic read
+        batch_status = status ;
+        if (batch_status < GrB_SUCCESS) continue ;
+
+        // cb = betweenness of all nodes, for the sources in this batch
+        GrB_Vector cb = NULL ;
+        char batch_msg [LAGRAPH_MSG_LEN] ;
+        int64_t start = b * ns ;
+        int32_t nb = (int32_t) LAGRAPH_MIN (ns, (int64_t) n - start) ;
+        batch_status = LAGr_Betweenness (&cb, G, sources + start, nb,
+            batch_msg) ;
+
+        #pragma omp critical (LG_betweenness_critical)
+        {
+            if (batch_status >= GrB_SUCCESS && status >= GrB_SUCCESS)
+            {
+                // centrality += cb
+                batch_status = GrB_eWiseAdd (*centrality, NULL, NULL,
+                    GrB_PLUS_FP64, *centrality, cb, NULL) ;
+            }
+            if (batch_status < GrB_SUCCESS && status >= GrB_SUCCESS)
+            {
+                // record the first error
+                #pragma omp atomic write
+                status = batch_status ;
+                if (msg != NULL)
+                {
+                    strncpy (msg, batch_msg, LAGRAPH_MSG_LEN-1) ;
+                    msg [LAGRAPH_MSG_LEN-1] = '\0' ;
+                }
+            }
+        }
+        GrB_free (&cb) ;
+    }
+
+    LG_TRY (status) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,254 @@
+//------------------------------------------------------------------------------
+// LAGraph_BreadthFirstSearch_Calibrate: tune the push/pull BFS thresholds
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// The push/pull heuristic of LG_BreadthFirstSearch_SSGrB switches from push to
+// pull when the # of edges incident on the frontier exceeds the # of
+// unexplored edges divided by alpha, and switches back when the frontier
+// shrinks below n/beta2 nodes (beta1 controls any later switch back to pull).
+// The defaults (alpha = 8, beta1 = 8, beta2 = 512) are tuned for the GAP
+// benchmark, and can be far from the best for power-law or road-network
+// graphs.  This method finds thresholds for a particular graph G and caches
+// them in G->bfs_alpha, G->bfs_beta1, and G->bfs_beta2.
+
+// An initial guess for alpha is made from the sampled mean and median degree
+// of the graph.  A large mean-to-median ratio (a few hubs, as in a power-law
+// graph) favors an early switch to pull, so alpha is increased.  A low mean
+// degree (as in a road network, with a large diameter and small frontiers)
+// favors push, so alpha is decreased.  The guess is then refined with a short
+// probe run: the BFS is timed from nprobes randomly chosen sources with a few
+// candidate values of alpha, then the best alpha is kept and the same is done
+// for beta2, and then for beta1.  beta1 is only used after the BFS has already
+// switched from pull back to push, so for many graphs its candidates take the
+// same time and beta1 keeps its default.
+
+// This method computes G->out_degree, and G->AT if G is directed and its
+// structure is not known to be symmetric, since the push/pull method requires
+// them.
+
+#include "LG_alg_internal.h"
+
+//------------------------------------------------------------------------------
+// LG_probe: time the BFS from all probe sources with the given thresholds
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL GrB_free (&level) ;
+
+static int LG_probe
+(
+    // output:
+    double *t,                  // total time taken for all searches
+    // input/output:
+    LAGraph_Graph G,            // G->bfs_* are set to alpha, beta1, and beta2
+    // input:
+    double alpha,
+    double beta1,
+    double beta2,
+    const GrB_Index *sources,
+    int64_t nsources,
+    char *msg
+)
+{
+    GrB_Vector level = NULL ;
+    G->bfs_alpha = alpha ;
+    G->bfs_beta1 = beta1 ;
+    G->bfs_beta2 = beta2 ;
+    double t0 = LAGraph_WallClockTime ( ) ;
+    for (int64_t k = 0 ; k < nsources ; k++)
+    {
+        LG_TRY (LG_BreadthFirstSearch_SSGrB (&level, NULL, NULL, G,
+            sources [k], msg)) ;
+        GrB_free (&level) ;
+    }
+    (*t) = LAGraph_WallClockTime ( ) - t0 ;
+    return (GrB_SUCCESS) ;
+}
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                    \
+{                                       \
+    GrB_free (&level) ;                 \
+    LAGraph_Free ((void **) &sources, NULL) ; \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                     \
+{                                       \
+    LG_FREE_WORK ;                      \
+    if (G != NULL)                      \
+    {                                   \
+        G->bfs_alpha = LAGRAPH_UNKNOWN ;\
+        G->bfs_beta1 = LAGRAPH_UNKNOWN ;\
+        G->bfs_beta2 = LAGRAPH_UNKNOWN ;\
+    }                                   \
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_BreadthFirstSearch_Calibrate
+//------------------------------------------------------------------------------
+
+int LAGraph_BreadthFirstSearch_Calibrate
+(
+    // input/output:
+    LAGraph_Graph G,
+    // input:
+    int64_t nprobes,
+    uint64_t seed,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Vector level = NULL ;
+    GrB_Index *sources = NULL ;
+    LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
+
+    if (G->bfs_alpha > 0 && G->bfs_beta1 > 0 && G->bfs_beta2 > 0)
+    {
+        // already calibrated
+        return (GrB_SUCCESS) ;
+    }
+
+    G->bfs_alpha = LG_BFS_ALPHA ;
+    G->bfs_beta1 = LG_BFS_BETA1 ;
+    G->bfs_beta2 = LG_BFS_BETA2 ;
+
+#if LAGRAPH_SUITESPARSE
+
+    //--------------------------------------------------------------------------
+    // compute the cached properties needed for the push/pull method
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+    if (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure != LAGraph_TRUE)
+    {
+        LG_TRY (LAGraph_Cached_AT (G, msg)) ;
+    }
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+
+    //--------------------------------------------------------------------------
+    // select the probe sources: random nodes with at least one out-edge
+    //--------------------------------------------------------------------------
+
+    nprobes = LAGRAPH_MAX (nprobes, 1) ;
+    LG_TRY (LAGraph_Malloc ((void **) &sources, nprobes, sizeof (GrB_Index),
+        msg)) ;
+    int64_t nsources = 0 ;
+    for (int64_t trial = 0 ; trial < 8 * nprobes && nsources < nprobes &&
+        n > 0 ; trial++)
+    {
+        GrB_Index src = LG_Random60 (&seed) % n ;
+        int64_t d = 0 ;
+        GrB_Info info = GrB_Vector_extractElement_INT64 (&d, G->out_degree,
+            src) ;
+        GRB_TRY (info) ;
+        if (info == GrB_SUCCESS && d > 0)
+        {
+            sources [nsources++] = src ;
+        }
+    }
+
+    if (nsources == 0)
+    {
+        // the graph has no edges, or none were found: use the defaults
+        LG_FREE_WORK ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // make an initial guess for alpha from the sampled degree
+    //--------------------------------------------------------------------------
+
+    double mean, median ;
+    LG_TRY (LAGr_SampleDegree (&mean, &median, G, true, 1000, seed, msg)) ;
+    double skew = mean / LAGRAPH_MAX (median, 1) ;
+    double alpha0 = LG_BFS_ALPHA * LAGRAPH_MAX (skew, 1) ;
+    if (mean < 4)
+    {
+        // low-degree graph with small frontiers; prefer push
+        alpha0 = alpha0 / 4 ;
+    }
+    alpha0 = LAGRAPH_MIN (alpha0, 1024) ;
+
+    //--------------------------------------------------------------------------
+    // refine alpha, then beta2, then beta1, with a short probe run
+    //--------------------------------------------------------------------------
+
+    double t, tbest ;
+    double beta1 = LG_BFS_BETA1 ;
+
+    // warmup, then time the initial guess
+    LG_TRY (LG_probe (&t, G, alpha0, beta1, LG_BFS_BETA2, sources, 1, msg)) ;
+    LG_TRY (LG_probe (&tbest, G, alpha0, beta1, LG_BFS_BETA2, sources,
+        nsources, msg)) ;
+    double alpha = alpha0 ;
+    double beta2 = LG_BFS_BETA2 ;
+
+    const double alpha_candidates [2] = { alpha0 / 4, alpha0 * 4 } ;
+    for (int k = 0 ; k < 2 ; k++)
+    {
+        LG_TRY (LG_probe (&t, G, alpha_candidates [k], beta1, LG_BFS_BETA2,
+            sources, nsources, msg)) ;
+        if (t < tbest)
+        {
+            tbest = t ;
+            alpha = alpha_candidates [k] ;
+        }
+    }
+
+    const double beta2_candidates [2] = { LG_BFS_BETA2 / 8, LG_BFS_BETA2 * 8 } ;
+    for (int k = 0 ; k < 2 ; k++)
+    {
+        LG_TRY (LG_probe (&t, G, alpha, beta1, beta2_candidates [k],
+            sources, nsources, msg)) ;
+        if (t < tbest)
+        {
+            tbest = t ;
+            beta2 = beta2_candidates [k] ;
+        }
+    }
+
+    const double beta1_candidates [2] = { LG_BFS_BETA1 / 4, LG_BFS_BETA1 * 4 } ;
+    for (int k = 0 ; k < 2 ; k++)
+    {
+        LG_TRY (LG_probe (&t, G, alpha, beta1_candidates [k], beta2,
+            sources, nsources, msg)) ;
+        if (t < tbest)
+        {
+            tbest = t ;
+            beta1 = beta1_candidates [k] ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // cache the result in G
+    //--------------------------------------------------------------------------
+
+    G->bfs_alpha = alpha ;
+    G->bfs_beta1 = beta1 ;
+    G->bfs_beta2 = beta2 ;
+    LG_FREE_WORK ;
+#endif
+
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,110 @@
+//------------------------------------------------------------------------------
+// LAGraph_SingleSourceShortestPath: SSSP with an automatic Delta, basic API
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// This is a Basic algorithm (G->emin, G->emax, and G->out_degree are
+// computed, if not present).
+
+// Delta-stepping works best when a bucket holds enough work to be done in
+// parallel, but not so much that the light edges must be relaxed many times
+// before the bucket is settled.  For random edge weights, a bucket width of
+// about emax / (mean degree) is a good choice (Meyer and Sanders, 2003), where
+// the mean degree is estimated by LAGr_SampleDegree.  Delta is never smaller
+// than emin, since with a smaller Delta each bucket would hold nodes reached
+// by single edges only.  For integer types, Delta is rounded up to an integer.
+
+// If adaptive is true, the width of each bucket is then adjusted from the size
+// and number of relaxation rounds of the last one, starting at this Delta.
+
+#define LG_FREE_ALL             \
+{                               \
+    GrB_free (&Delta) ;         \
+}
+
+#include "LG_alg_internal.h"
+
+int LAGraph_SingleSourceShortestPath
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    // input/output:
+    LAGraph_Graph G,            // input graph; cached properties computed
+    // input:
+    GrB_Index source,           // source vertex
+    bool adaptive,              // if true, adapt Delta between buckets
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs and compute the cached properties
+    //--------------------------------------------------------------------------
+
+    GrB_Scalar Delta = NULL ;
+    LG_TRY (LAGraph_Cached_EMin (G, msg)) ;
+    LG_TRY (LAGraph_Cached_EMax (G, msg)) ;
+    LG_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+    LG_ASSERT (path_length != NULL, GrB_NULL_POINTER) ;
+    (*path_length) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // estimate Delta
+    //--------------------------------------------------------------------------
+
+    // emin and emax are left as zero if the graph has no edges
+    double emin = 0, emax = 0, mean = 0, median = 0 ;
+    GRB_TRY (GrB_Scalar_extractElement_FP64 (&emin, G->emin)) ;
+    GRB_TRY (GrB_Scalar_extractElement_FP64 (&emax, G->emax)) ;
+    GrB_Index nvals ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+    if (nvals > 0)
+    {
+        LG_TRY (LAGr_SampleDegree (&mean, &median, G, true, 1000, 1, msg)) ;
+    }
+
+    double delta = emax / LAGRAPH_MAX (mean, 1) ;
+    delta = LAGRAPH_MAX (delta, emin) ;
+
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, G->A, msg)) ;
+    if (!(MATCHNAME (typename, "float") || MATCHNAME (typename, "double")))
+    {
+        // integer edge weights: use an integer Delta
+        delta = ceil (delta) ;
+    }
+    if (!(delta > 0))
+    {
+        // the graph has no edges, or no positive edge weights
+        delta = 1 ;
+    }
+
+    // The adaptive method splits the light and heavy edges at 4*Delta, and
+    // starts with a bucket of width Delta, which it can widen up to 4*Delta.
+    if (adaptive) delta = 4 * delta ;
+
+    GRB_TRY (GrB_Scalar_new (&Delta, GrB_FP64)) ;
+    GRB_TRY (GrB_Scalar_setElement_FP64 (Delta, delta)) ;
+
+    //--------------------------------------------------------------------------
+    // compute the shortest paths
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_SingleSourceShortestPath (path_length, NULL, G, source, Delta,
+        adaptive, msg)) ;
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,223 @@
+//------------------------------------------------------------------------------
+// LAGraph_TriangleCount_Calibrate: select the triangle counting method
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// The AutoMethod and AutoSort rules of LAGr_TriangleCount always select the
+// Sandia_LUT method, and sort the graph only if its sampled mean degree is
+// much higher than its median degree.  This is a good choice for most large
+// graphs, but not all of them (the saxpy-based Sandia_LL method is faster for
+// the GAP-urand graph, for example, and the Intersect method can be faster
+// for graphs with a skewed degree distribution).  This method selects the
+// fastest method and presort for a particular graph G by timing the
+// candidates on a sample of G, and caches them in G->tc_method and
+// G->tc_presort.
+
+// The candidates are the Sandia_LL, Sandia_UU, Sandia_LUT, Sandia_ULT, and
+// Intersect methods, each with no presort and with the presort that the
+// AutoSort rule would select for it (ascending for Sandia_LL, Sandia_LUT, and
+// Intersect, and descending for Sandia_UU and Sandia_ULT).  The Burkhardt and
+// Cohen methods are always slower, and are not tried.  Each candidate is run
+// three times, and the fastest run is kept.
+
+// The sample is the subgraph induced by nsamples nodes selected at random: the
+// edges of G with both endpoints in the sample.  If a fraction f of the nodes
+// is sampled, each edge of G is kept with probability f^2, and each triangle
+// with probability f^3, so the sample is a scaled-down copy of G, with the
+// degree of each node scaled by about f.  The sampled nodes keep their
+// relative order.  If nsamples is zero or less, a default of
+// max (n/4, min (n, 1000)) nodes is used: all n nodes if n is 1000 or less,
+// 1000 nodes if n is between 1000 and 4000, and n/4 nodes otherwise, which
+// keeps about 1/16th of the edges.  The whole graph is used if nsamples >= n.
+
+// This method computes G->nself_edges and G->out_degree, since they are
+// required by LAGr_TriangleCount.
+
+#include "LG_alg_internal.h"
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                    \
+{                                                       \
+    GrB_free (&As) ;                                    \
+    LAGraph_Delete (&Gsample, NULL) ;                   \
+    LAGraph_Free ((void **) &S, NULL) ;                 \
+    LAGraph_Free ((void **) &mark, NULL) ;              \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                     \
+{                                                       \
+    LG_FREE_WORK ;                                      \
+    if (G != NULL)                                      \
+    {                                                   \
+        G->tc_method = LAGRAPH_UNKNOWN ;                \
+        G->tc_presort = LAGr_TriangleCount_AutoSort ;   \
+    }                                                   \
+}
+
+int LAGraph_TriangleCount_Calibrate
+(
+    // input/output:
+    LAGraph_Graph G,
+    // input:
+    int64_t nsamples,
+    uint64_t seed,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix As = NULL ;
+    LAGraph_Graph Gsample = NULL ;
+    GrB_Index *S = NULL ;
+    bool *mark = NULL ;
+    LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
+
+    if (G->tc_method > 0)
+    {
+        // already calibrated
+        return (GrB_SUCCESS) ;
+    }
+
+    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)),
+        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
+        "G->A must be known to be symmetric") ;
+
+    //--------------------------------------------------------------------------
+    // compute the cached properties needed for triangle counting
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Cached_NSelfEdges (G, msg)) ;
+    LG_ASSERT (G->nself_edges == 0, LAGRAPH_NO_SELF_EDGES_ALLOWED) ;
+    LG_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+
+    //--------------------------------------------------------------------------
+    // construct the sample of G
+    //--------------------------------------------------------------------------
+
+    if (nsamples <= 0)
+    {
+        // default: n/4 nodes, but at least 1000 (or all n, if n <= 1000)
+        nsamples = LAGRAPH_MAX (n / 4, LAGRAPH_MIN (n, 1000)) ;
+    }
+
+    LAGraph_Graph Gs = G ;
+    if ((GrB_Index) nsamples < n)
+    {
+        // S = up to nsamples distinct nodes, selected at random, in
+        // ascending order
+        LG_TRY (LAGraph_Calloc ((void **) &mark, n, sizeof (bool), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &S, nsamples, sizeof (GrB_Index),
+            msg)) ;
+        for (int64_t k = 0 ; k < nsamples ; k++)
+        {
+            mark [LG_Random60 (&seed) % n] = true ;
+        }
+        int64_t ns = 0 ;
+        for (GrB_Index i = 0 ; i < n ; i++)
+        {
+            if (mark [i]) S [ns++] = i ;
+        }
+
+        // As = A (S,S), the subgraph induced by the nodes in S
+        GRB_TRY (GrB_Matrix_new (&As, GrB_BOOL, ns, ns)) ;
+        GRB_TRY (GrB_extract (As, NULL, NULL, G->A, S, ns, S, ns, NULL)) ;
+
+        LG_TRY (LAGraph_New (&Gsample, &As, LAGraph_ADJACENCY_UNDIRECTED,
+            msg)) ;
+        LG_TRY (LAGraph_Cached_NSelfEdges (Gsample, msg)) ;
+        LG_TRY (LAGraph_Cached_OutDegree (Gsample, msg)) ;
+        Gs = Gsample ;
+    }
+
+    //--------------------------------------------------------------------------
+    // time each candidate method and presort on the sample
+    //--------------------------------------------------------------------------
+
+    #define NCANDIDATES 5
+    // each candidate is timed this many times, to reduce timing noise
+    #define LG_TC_NTRIALS 3
+    const LAGr_TriangleCount_Method candidates [NCANDIDATES] =
+    {
+        LAGr_TriangleCount_Sandia_LL,
+        LAGr_TriangleCount_Sandia_UU,
+        LAGr_TriangleCount_Sandia_LUT,
+        LAGr_TriangleCount_Sandia_ULT,
+        LAGr_TriangleCount_Intersect
+    } ;
+    const LAGr_TriangleCount_Presort candidate_sort [NCANDIDATES] =
+    {
+        LAGr_TriangleCount_Ascending,
+        LAGr_TriangleCount_Descending,
+        LAGr_TriangleCount_Ascending,
+        LAGr_TriangleCount_Descending,
+        LAGr_TriangleCount_Ascending
+    } ;
+
+    // warmup, with the default method
+    uint64_t ntri ;
+    LAGr_TriangleCount_Method method = LAGr_TriangleCount_Sandia_LUT ;
+    LAGr_TriangleCount_Presort presort = LAGr_TriangleCount_NoSort ;
+    LG_TRY (LG_TriangleCount (&ntri, NULL, NULL, Gs, &method, &presort, msg)) ;
+
+    LAGr_TriangleCount_Method best_method = LAGr_TriangleCount_Sandia_LUT ;
+    LAGr_TriangleCount_Presort best_presort = LAGr_TriangleCount_NoSort ;
+    double tbest = INFINITY ;
+    for (int k = 0 ; k < NCANDIDATES ; k++)
+    {
+        for (int s = 0 ; s < 2 ; s++)
+        {
+            // time the method, with no presort and with its own presort,
+            // keeping the fastest of LG_TC_NTRIALS runs
+            LAGr_TriangleCount_Method m = candidates [k] ;
+            LAGr_TriangleCount_Presort p = (s == 0) ?
+                LAGr_TriangleCount_NoSort : candidate_sort [k] ;
+            double tmin = INFINITY ;
+            for (int trial = 0 ; trial < LG_TC_NTRIALS ; trial++)
+            {
+                LAGr_TriangleCount_Method mt = m ;
+                LAGr_TriangleCount_Presort pt = p ;
+                double t = LAGraph_WallClockTime ( ) ;
+                LG_TRY (LG_TriangleCount (&ntri, NULL, NULL, Gs, &mt, &pt,
+                    msg)) ;
+                t = LAGraph_WallClockTime ( ) - t ;
+                tmin = LAGRAPH_MIN (tmin, t) ;
+            }
+            if (tmin < tbest)
+            {
+                tbest = tmin ;
+                best_method = m ;
+                best_presort = p ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // cache the result in G
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    G->tc_method = best_method ;
+    G->tc_presort = best_presort ;
+    return (GrB_SUCCESS) ;
+}
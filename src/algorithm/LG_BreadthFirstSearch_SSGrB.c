@@ -21,6 +21,16 @@
 // user-callable (see LAGr_BreadthFirstSearch instead).  G->AT and
 // G->out_degree are not computed if not present.
 
+// The thresholds alpha, beta1, and beta2 of the push/pull heuristic are taken
+// from G->bfs_alpha, G->bfs_beta1, and G->bfs_beta2, if they have been
+// calibrated for this graph by LAGraph_BreadthFirstSearch_Calibrate.
+// Otherwise, the defaults are used, as tuned for the GAP benchmark.
+
+// If direction is not NULL, it is returned as a boolean vector, where
+// direction(k) is true if the kth level was computed with a pull step, or
+// false if it was computed with a push step (see
+// LAGr_BreadthFirstSearch_Report).
+
 // References:
 //
 // Carl Yang, Aydin Buluc, and John D. Owens. 2018. Implementing Push-Pull
@@ -44,14 +54,16 @@
     LG_FREE_WORK ;          \
     GrB_free (&pi) ;        \
     GrB_free (&v) ;         \
+    GrB_free (&dir) ;       \
 }
 
-#include "LG_internal.h"
+#include "LG_alg_internal.h"
 
 int LG_BreadthFirstSearch_SSGrB
 (
     GrB_Vector *level,
     GrB_Vector *parent,
+    GrB_Vector *direction,
     const LAGraph_Graph G,
     GrB_Index src,
     char *msg
@@ -67,6 +79,7 @@ int LG_BreadthFirstSearch_SSGrB
     GrB_Vector w = NULL ;           // to compute work remaining
     GrB_Vector pi = NULL ;          // parent vector
     GrB_Vector v = NULL ;           // level vector
+    GrB_Vector dir = NULL ;         // direction of each level
 
 #if !LAGRAPH_SUITESPARSE
     LG_ASSERT (false, GrB_NOT_IMPLEMENTED) ;
@@ -74,8 +87,10 @@ int LG_BreadthFirstSearch_SSGrB
 
     bool compute_level  = (level != NULL) ;
     bool compute_parent = (parent != NULL) ;
+    bool compute_dir    = (direction != NULL) ;
     if (compute_level ) (*level ) = NULL ;
     if (compute_parent) (*parent) = NULL ;
+    if (compute_dir   ) (*direction) = NULL ;
     LG_ASSERT_MSG (compute_level || compute_parent, GrB_NULL_POINTER,
         "either level or parent must be non-NULL") ;
 
@@ -153,13 +168,20 @@ int LG_BreadthFirstSearch_SSGrB
         GRB_TRY (GrB_Vector_setElement (v, 0, src)) ;
     }
 
+    if (compute_dir)
+    {
+        // create the direction vector, of size n for now
+        GRB_TRY (GrB_Vector_new (&dir, GrB_BOOL, n)) ;
+    }
+
     // workspace for computing work remaining
     GRB_TRY (GrB_Vector_new (&w, GrB_INT64, n)) ;
 
+    // use the thresholds calibrated for this graph, if present
     GrB_Index nq = 1 ;          // number of nodes in the current level
-    double alpha = 8.0 ;
-    double beta1 = 8.0 ;
-    double beta2 = 512.0 ;
+    double alpha = (G->bfs_alpha > 0) ? G->bfs_alpha : LG_BFS_ALPHA ;
+    double beta1 = (G->bfs_beta1 > 0) ? G->bfs_beta1 : LG_BFS_BETA1 ;
+    double beta2 = (G->bfs_beta2 > 0) ? G->bfs_beta2 : LG_BFS_BETA2 ;
     int64_t n_over_beta1 = (int64_t) (((double) n) / beta1) ;
     int64_t n_over_beta2 = (int64_t) (((double) n) / beta2) ;
 
@@ -171,6 +193,7 @@ int LG_BreadthFirstSearch_SSGrB
     GrB_Index last_nq = 0 ;
     int64_t edges_unexplored = nvals ;
     bool any_pull = false ;     // true if any pull phase has been done
+    int64_t nlevels = 0 ;       // largest level of any node reached
 
     // {!mask} is the set of unvisited nodes
     GrB_Vector mask = (compute_parent) ? pi : v ;
@@ -284,6 +307,18 @@ int LG_BreadthFirstSearch_SSGrB
             // v{q} = k, the kth level of the BFS
             GRB_TRY (GrB_assign (v, q, NULL, k, GrB_ALL, n, GrB_DESC_S)) ;
         }
+        if (compute_dir)
+        {
+            // dir(k) = true if the kth level was computed with a pull step
+            GRB_TRY (GrB_Vector_setElement (dir, !do_push, k)) ;
+        }
+        nlevels = k ;
+    }
+
+    if (compute_dir)
+    {
+        // the direction vector has size nlevels+1; dir(0) is not present
+        GRB_TRY (GrB_Vector_resize (dir, nlevels + 1)) ;
     }
 
     //--------------------------------------------------------------------------
@@ -292,6 +327,7 @@ int LG_BreadthFirstSearch_SSGrB
 
     if (compute_parent) (*parent) = pi ;
     if (compute_level ) (*level ) = v ;
+    if (compute_dir   ) (*direction) = dir ;
     LG_FREE_WORK ;
     return (GrB_SUCCESS) ;
 #endif
@@ -0,0 +1,509 @@
+//------------------------------------------------------------------------------
+// LG_SingleSourceShortestPath: single-source shortest path
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Jinhao Chen, Scott Kolodziej and Tim Davis, Texas A&M
+// University.  Adapted from GraphBLAS Template Library (GBTL) by Scott
+// McMillan and Tze Meng Low.
+
+//------------------------------------------------------------------------------
+
+// Single source shortest path with delta stepping.  This is the internal
+// method used by both LAGr_SingleSourceShortestPath (with a fixed Delta) and
+// LAGraph_SingleSourceShortestPath (with an automatic Delta).  G->emin is
+// used if present, to determine if the graph has negative edge weights.
+
+// U. Sridhar, M. Blanco, R. Mayuranath, D. G. Spampinato, T. M. Low, and
+// S. McMillan, "Delta-Stepping SSSP: From Vertices and Edges to GraphBLAS
+// Implementations," in 2019 IEEE International Parallel and Distributed
+// Processing Symposium Workshops (IPDPSW), 2019, pp. 241–250.
+// https://ieeexplore.ieee.org/document/8778222/references
+// https://arxiv.org/abs/1911.06895
+
+// LG_SingleSourceShortestPath computes the shortest path lengths from the
+// specified source vertex to all other vertices in the graph.
+
+// If requested, the parent vector is computed after the path lengths are
+// found, from the edges on shortest paths: those with t(i) + A(i,j) == t(j),
+// which are found with a min_plus product of diag(t) and A.  If all edge
+// weights are known to be positive (G->emin > 0), these edges form an acyclic
+// graph, and parent(j) is the smallest i of any such edge, found with a
+// min-with-index reduction.  Otherwise, a zero-weight cycle could also
+// consist of such edges, and the parent vector is found from a breadth-first
+// search of this subgraph instead.  In either case, parent(source) = source,
+// and parent(j) is not present if j is not reachable from the source.
+
+// NOTE: this method gets stuck in an infinite loop when there are negative-
+// weight cycles in the graph.
+
+// If adaptive is false, each bucket has width Delta, which is also the
+// threshold between the light edges (AL) and heavy edges (AH).  If adaptive is
+// true, the buckets are built from sub-buckets of width delta = Delta/8 (or
+// less, so that delta is at least 1 for integer types), and the width of the
+// next bucket is chosen from what was observed in the last one.  A bucket that
+// is empty, or that settles its nodes with just a few light-edge relaxations,
+// is too narrow, so the width is doubled.  A bucket that needs many
+// relaxations is too wide, so its width is halved.  The width always stays in
+// the range delta to Delta, so that no heavy edge can land in the bucket it
+// comes from, which keeps the method correct.  The bucket starts with a width
+// of Delta/4.
+
+#define LG_FREE_WORK        \
+{                           \
+    GrB_free (&AL) ;        \
+    GrB_free (&AH) ;        \
+    GrB_free (&lBound) ;    \
+    GrB_free (&uBound) ;    \
+    GrB_free (&tmasked) ;   \
+    GrB_free (&tReq) ;      \
+    GrB_free (&tless) ;     \
+    GrB_free (&s) ;         \
+    GrB_free (&reach) ;     \
+    GrB_free (&Empty) ;     \
+    GrB_free (&infinity) ;  \
+    GrB_free (&tr) ;        \
+    GrB_free (&D) ;         \
+    GrB_free (&C) ;         \
+    GrB_free (&M) ;         \
+    GrB_free (&E) ;         \
+    GrB_free (&pbfs) ;      \
+    LAGraph_Delete (&Gtight, NULL) ; \
+}
+
+#define LG_FREE_ALL         \
+{                           \
+    LG_FREE_WORK ;          \
+    GrB_free (&t) ;         \
+    GrB_free (&p) ;         \
+}
+
+#include "LG_alg_internal.h"
+
+// adaptive bucket widths: Delta is split into 2^LG_SSSP_G sub-buckets
+#define LG_SSSP_G 3
+// widen the next bucket if the last one needed this many rounds or fewer:
+#define LG_SSSP_WIDEN 2
+// narrow the next bucket if the last one needed more than this many rounds:
+#define LG_SSSP_NARROW 8
+
+#define setelement(s, k)                                                      \
+{                                                                             \
+    switch (tcode)                                                            \
+    {                                                                         \
+        default:                                                              \
+        case 0 : GrB_Scalar_setElement_INT32  (s, k * delta_int32 ) ; break ; \
+        case 1 : GrB_Scalar_setElement_INT64  (s, k * delta_int64 ) ; break ; \
+        case 2 : GrB_Scalar_setElement_UINT32 (s, k * delta_uint32) ; break ; \
+        case 3 : GrB_Scalar_setElement_UINT64 (s, k * delta_uint64) ; break ; \
+        case 4 : GrB_Scalar_setElement_FP32   (s, k * delta_fp32  ) ; break ; \
+        case 5 : GrB_Scalar_setElement_FP64   (s, k * delta_fp64  ) ; break ; \
+    }                                                                         \
+}
+
+int LG_SingleSourceShortestPath
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    GrB_Vector *parent,         // parent (i) is the parent of vertex i in the
+                                // shortest path tree (optional; may be NULL)
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Index source,           // source vertex
+    GrB_Scalar Delta,           // delta value for delta stepping
+    bool adaptive,              // if true, adapt the bucket width
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Scalar lBound = NULL ;  // the threshold for GrB_select
+    GrB_Scalar uBound = NULL ;  // the threshold for GrB_select
+    GrB_Matrix AL = NULL ;      // graph containing the light weight edges
+    GrB_Matrix AH = NULL ;      // graph containing the heavy weight edges
+    GrB_Vector t = NULL ;       // tentative shortest path length
+    GrB_Vector tmasked = NULL ;
+    GrB_Vector tReq = NULL ;
+    GrB_Vector tless = NULL ;
+    GrB_Vector s = NULL ;
+    GrB_Vector reach = NULL ;
+    GrB_Vector Empty = NULL ;
+    GrB_Scalar infinity = NULL ;    // the path length of unreachable nodes
+    GrB_Vector tr = NULL ;      // path lengths of the reachable nodes
+    GrB_Matrix D = NULL ;       // D = diag (tr)
+    GrB_Matrix C = NULL ;       // C(i,j) = t(i) + A(i,j)
+    GrB_Matrix M = NULL ;       // M(i,j) = t(j)
+    GrB_Matrix E = NULL ;       // edges on shortest paths
+    GrB_Vector p = NULL ;       // parent vector
+    GrB_Vector pbfs = NULL ;    // parent vector from the BFS
+    LAGraph_Graph Gtight = NULL ;
+
+    if (path_length != NULL) (*path_length) = NULL ;
+    if (parent      != NULL) (*parent     ) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (path_length != NULL || parent != NULL, GrB_NULL_POINTER,
+        "either path_length or parent must be non-NULL") ;
+    LG_ASSERT (Delta != NULL, GrB_NULL_POINTER) ;
+
+    GrB_Index nvals ;
+    LG_TRY (GrB_Scalar_nvals (&nvals, Delta)) ;
+    LG_ASSERT_MSG (nvals == 1, GrB_EMPTY_OBJECT, "Delta is missing") ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    LG_ASSERT_MSG (source < n, GrB_INVALID_INDEX, "invalid source node") ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    // select the operators for the type of the A matrix, and check if the
+    // graph might have negative (or zero) edge weights
+    LG_SSSP_Operators ops ;
+    LG_TRY (LG_SSSP_GetOperators (&ops, &infinity, G, msg)) ;
+    GrB_Type etype = ops.type ;
+    GrB_IndexUnaryOp ne = ops.ne, le = ops.le, ge = ops.ge, lt = ops.lt,
+        gt = ops.gt ;
+    GrB_BinaryOp less_than = ops.less_than, eq = ops.eq ;
+    GrB_Semiring min_plus = ops.min_plus, min_second = ops.min_second ;
+    int tcode = ops.tcode ;
+    bool negative_edge_weights = ops.negative_edge_weights ;
+    bool positive_edge_weights = ops.positive_edge_weights ;
+
+    GRB_TRY (GrB_Scalar_new (&lBound, etype)) ;
+    GRB_TRY (GrB_Scalar_new (&uBound, etype)) ;
+    GRB_TRY (GrB_Vector_new (&t, etype, n)) ;
+    GRB_TRY (GrB_Vector_new (&tmasked, etype, n)) ;
+    GRB_TRY (GrB_Vector_new (&tReq, etype, n)) ;
+    GRB_TRY (GrB_Vector_new (&Empty, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&tless, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&s, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&reach, GrB_BOOL, n)) ;
+
+#if LAGRAPH_SUITESPARSE
+    // optional hints for SuiteSparse:GraphBLAS
+    GRB_TRY (GxB_set (t, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    GRB_TRY (GxB_set (tmasked, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (tReq, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (tless, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (s, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (reach, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+#endif
+
+    // t (:) = infinity
+    GRB_TRY (GrB_Vector_assign_Scalar (t, NULL, NULL, infinity, GrB_ALL, n,
+        NULL)) ;
+
+    // get the value of Delta
+    int32_t  delta_int32  ;
+    int64_t  delta_int64  ;
+    uint32_t delta_uint32 ;
+    uint64_t delta_uint64 ;
+    float    delta_fp32   ;
+    double   delta_fp64   ;
+    switch (tcode)
+    {
+        default:
+        case 0 : GRB_TRY (GrB_Scalar_extractElement (&delta_int32 , Delta)) ;
+                 break ;
+        case 1 : GRB_TRY (GrB_Scalar_extractElement (&delta_int64 , Delta)) ;
+                 break ;
+        case 2 : GRB_TRY (GrB_Scalar_extractElement (&delta_uint32, Delta)) ;
+                 break ;
+        case 3 : GRB_TRY (GrB_Scalar_extractElement (&delta_uint64, Delta)) ;
+                 break ;
+        case 4 : GRB_TRY (GrB_Scalar_extractElement (&delta_fp32  , Delta)) ;
+                 break ;
+        case 5 : GRB_TRY (GrB_Scalar_extractElement (&delta_fp64  , Delta)) ;
+                 break ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sub-bucket width, for the adaptive method
+    //--------------------------------------------------------------------------
+
+    // Each bucket is [lo*delta, (lo+m)*delta), where delta = Delta / 2^g and
+    // 1 <= m <= 2^g.  The non-adaptive method uses g = 0 and m = 1, so that
+    // the bucket width is always Delta.
+
+    int g = 0 ;
+    if (adaptive)
+    {
+        g = LG_SSSP_G ;
+        switch (tcode)
+        {
+            default:
+            case 0 : while (g > 0 && delta_int32  < (1 << g)) g-- ;
+                     delta_int32  /= (1 << g) ; break ;
+            case 1 : while (g > 0 && delta_int64  < (1 << g)) g-- ;
+                     delta_int64  /= (1 << g) ; break ;
+            case 2 : while (g > 0 && delta_uint32 < (1u << g)) g-- ;
+                     delta_uint32 /= (1 << g) ; break ;
+            case 3 : while (g > 0 && delta_uint64 < (1u << g)) g-- ;
+                     delta_uint64 /= (1 << g) ; break ;
+            case 4 : delta_fp32 /= (1 << g) ; break ;
+            case 5 : delta_fp64 /= (1 << g) ; break ;
+        }
+    }
+    int64_t mmax = ((int64_t) 1) << g ;
+    int64_t m = LAGRAPH_MAX (mmax / 4, 1) ;
+
+    // t (src) = 0
+    GRB_TRY (GrB_Vector_setElement (t, 0, source)) ;
+
+    // reach (src) = true
+    GRB_TRY (GrB_Vector_setElement (reach, true, source)) ;
+
+    // s (src) = true
+    GRB_TRY (GrB_Vector_setElement (s, true, source)) ;
+
+    // AL = A .* (A <= Delta)
+    GRB_TRY (GrB_Matrix_new (&AL, etype, n, n)) ;
+    GRB_TRY (GrB_select (AL, NULL, NULL, le, A, Delta, NULL)) ;
+    GRB_TRY (GrB_wait (AL, GrB_MATERIALIZE)) ;
+
+    // FUTURE: costly for some problems, taking up to 50% of the total time:
+    // AH = A .* (A > Delta)
+    GRB_TRY (GrB_Matrix_new (&AH, etype, n, n)) ;
+    GRB_TRY (GrB_select (AH, NULL, NULL, gt, A, Delta, NULL)) ;
+    GRB_TRY (GrB_wait (AH, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // while (t >= lo*delta) not empty
+    //--------------------------------------------------------------------------
+
+    for (int64_t lo = 0 ; ; )
+    {
+
+        //----------------------------------------------------------------------
+        // tmasked = all entries in t<reach> that are less than (lo+m)*delta
+        //----------------------------------------------------------------------
+
+        setelement (uBound, (lo+m)) ;          // uBound = (lo+m) * delta
+        GRB_TRY (GrB_Vector_clear (tmasked)) ;
+
+        // tmasked<reach> = t
+        // FUTURE: this is costly, typically using Method 06s in SuiteSparse,
+        // which is a very general-purpose one.  Write a specialized kernel to
+        // exploit the fact that reach and t are bitmap and tmasked starts
+        // empty, or fuse this assignment with the GrB_select below.
+        GRB_TRY (GrB_assign (tmasked, reach, NULL, t, GrB_ALL, n, NULL)) ;
+        // tmasked = select (tmasked < (lo+m)*delta)
+        GRB_TRY (GrB_select (tmasked, NULL, NULL, lt, tmasked, uBound, NULL)) ;
+        // --- alternative:
+        // FUTURE this is slower than the above but should be much faster.
+        // GrB_select is computing a bitmap result then converting it to
+        // sparse.  t and reach are both bitmap and tmasked finally sparse.
+        // tmasked<reach> = select (t < (lo+m)*delta)
+        // GRB_TRY (GrB_select (tmasked, reach, NULL, lt, t, uBound, NULL)) ;
+
+        GrB_Index tmasked_nvals ;
+        GRB_TRY (GrB_Vector_nvals (&tmasked_nvals, tmasked)) ;
+
+        //----------------------------------------------------------------------
+        // continue while the current bucket (tmasked) is not empty
+        //----------------------------------------------------------------------
+
+        int64_t nrounds = 0 ;
+        while (tmasked_nvals > 0)
+        {
+            nrounds++ ;
+
+            // tReq = AL'*tmasked using the min_plus semiring
+            GRB_TRY (GrB_vxm (tReq, NULL, NULL, min_plus, tmasked, AL, NULL)) ;
+
+            // s<struct(tmasked)> = true
+            GRB_TRY (GrB_assign (s, tmasked, NULL, (bool) true, GrB_ALL, n,
+                GrB_DESC_S)) ;
+
+            // if nvals (tReq) is 0, no need to continue the rest of this loop
+            GrB_Index tReq_nvals ;
+            GRB_TRY (GrB_Vector_nvals (&tReq_nvals, tReq)) ;
+            if (tReq_nvals == 0) break ;
+
+            // tless = (tReq .< t) using set intersection
+            GRB_TRY (GrB_eWiseMult (tless, NULL, NULL, less_than, tReq, t,
+                NULL)) ;
+
+            // remove explicit zeros from tless so it can be used as a
+            // structural mask
+            GrB_Index tless_nvals ;
+            GRB_TRY (GrB_select (tless, NULL, NULL, ne, tless, 0, NULL)) ;
+            GRB_TRY (GrB_Vector_nvals (&tless_nvals, tless)) ;
+            if (tless_nvals == 0) break ;
+
+            // update reachable node list/mask
+            // reach<struct(tless)> = true
+            GRB_TRY (GrB_assign (reach, tless, NULL, (bool) true, GrB_ALL, n,
+                GrB_DESC_S)) ;
+
+            // tmasked<struct(tless)> = select (tReq < (lo+m)*delta)
+            GRB_TRY (GrB_Vector_clear (tmasked)) ;
+            GRB_TRY (GrB_select (tmasked, tless, NULL, lt, tReq, uBound,
+                GrB_DESC_S)) ;
+
+            // For general graph with some negative weights:
+            if (negative_edge_weights)
+            {
+                // If all entries of the graph are known to be positive, and
+                // the entries of tmasked are at least lo*delta, tReq =
+                // tmasked min.+ AL must be >= lo*delta.  Therefore, there is
+                // no need to perform this GrB_select with ge to find tmasked
+                // >= lo*delta from tReq.
+                setelement (lBound, (lo)) ;    // lBound = lo*delta
+                // tmasked = select entries in tmasked that are >= lo*delta
+                GRB_TRY (GrB_select (tmasked, NULL, NULL, ge, tmasked, lBound,
+                    NULL)) ;
+            }
+
+            // t<struct(tless)> = tReq
+            GRB_TRY (GrB_assign (t, tless, NULL, tReq, GrB_ALL, n, GrB_DESC_S));
+            GRB_TRY (GrB_Vector_nvals (&tmasked_nvals, tmasked)) ;
+        }
+
+        // tmasked<s> = t
+        GRB_TRY (GrB_Vector_clear (tmasked)) ;
+        GRB_TRY (GrB_assign (tmasked, s, NULL, t, GrB_ALL, n, GrB_DESC_S)) ;
+
+        // tReq = AH'*tmasked using the min_plus semiring
+        GRB_TRY (GrB_vxm (tReq, NULL, NULL, min_plus, tmasked, AH, NULL)) ;
+
+        // tless = (tReq .< t) using set intersection
+        GRB_TRY (GrB_eWiseMult (tless, NULL, NULL, less_than, tReq, t, NULL)) ;
+
+        // t<tless> = tReq, which computes t = min (t, tReq)
+        GRB_TRY (GrB_assign (t, tless, NULL, tReq, GrB_ALL, n, NULL)) ;
+
+        //----------------------------------------------------------------------
+        // find out how many left to be computed
+        //----------------------------------------------------------------------
+
+        // update reachable node list
+        // reach<tless> = true
+        GRB_TRY (GrB_assign (reach, tless, NULL, (bool) true, GrB_ALL, n,
+            NULL)) ;
+
+        // remove previous buckets
+        // reach<struct(s)> = Empty
+        GRB_TRY (GrB_assign (reach, s, NULL, Empty, GrB_ALL, n, GrB_DESC_S)) ;
+        GrB_Index nreach ;
+        GRB_TRY (GrB_Vector_nvals (&nreach, reach)) ;
+        if (nreach == 0) break ;
+
+        //----------------------------------------------------------------------
+        // move to the next bucket, and choose its width
+        //----------------------------------------------------------------------
+
+        lo += m ;
+        if (adaptive)
+        {
+            GrB_Index nsettled ;
+            GRB_TRY (GrB_Vector_nvals (&nsettled, s)) ;
+            if (nsettled == 0 || nrounds <= LG_SSSP_WIDEN)
+            {
+                // the bucket was empty or easy to settle: widen the next one
+                m = LAGRAPH_MIN (2 * m, mmax) ;
+            }
+            else if (nrounds > LG_SSSP_NARROW)
+            {
+                // the bucket took many rounds to settle: narrow the next one
+                m = LAGRAPH_MAX (m / 2, 1) ;
+            }
+        }
+
+        GRB_TRY (GrB_Vector_clear (s)) ; // clear s for the next iteration
+    }
+
+    //--------------------------------------------------------------------------
+    // compute the parent vector, if requested
+    //--------------------------------------------------------------------------
+
+    if (parent != NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // find the edges on shortest paths
+        //----------------------------------------------------------------------
+
+        // tr = t (t != infinity), the path lengths of the reachable nodes
+        GRB_TRY (GrB_Vector_new (&tr, etype, n)) ;
+        GRB_TRY (GrB_select (tr, NULL, NULL, ne, t, infinity, NULL)) ;
+
+        // C(i,j) = t(i) + A(i,j), for all edges leaving reachable nodes
+        GRB_TRY (GrB_Matrix_diag (&D, tr, 0)) ;
+        GRB_TRY (GrB_Matrix_new (&C, etype, n, n)) ;
+        GRB_TRY (GrB_mxm (C, NULL, NULL, min_plus, D, A, NULL)) ;
+
+        // M<struct(C)> = C min.second D, so that M(i,j) = t(j)
+        GRB_TRY (GrB_Matrix_new (&M, etype, n, n)) ;
+        GRB_TRY (GrB_mxm (M, C, NULL, min_second, C, D, GrB_DESC_S)) ;
+
+        // E = (C == M), with self-edges and the false entries removed
+        GRB_TRY (GrB_Matrix_new (&E, GrB_BOOL, n, n)) ;
+        GRB_TRY (GrB_eWiseMult (E, NULL, NULL, eq, C, M, NULL)) ;
+        GRB_TRY (GrB_select (E, NULL, NULL, GrB_OFFDIAG, E, 0, NULL)) ;
+        GRB_TRY (GrB_select (E, NULL, NULL, GrB_VALUEEQ_BOOL, E, true, NULL)) ;
+
+        //----------------------------------------------------------------------
+        // construct the parent vector from E
+        //----------------------------------------------------------------------
+
+        if (positive_edge_weights)
+        {
+            // E is acyclic: parent(j) = min (i) for any edge E(i,j)
+            // C(i,j) = i for each edge E(i,j)
+            GRB_TRY (GrB_free (&C)) ;
+            GRB_TRY (GrB_Matrix_new (&C, GrB_INT64, n, n)) ;
+            GRB_TRY (GrB_apply (C, NULL, NULL, GrB_ROWINDEX_INT64, E, 0,
+                NULL)) ;
+            // p(j) = min (C (:,j))
+            GRB_TRY (GrB_Vector_new (&p, GrB_INT64, n)) ;
+            GRB_TRY (GrB_reduce (p, NULL, NULL, GrB_MIN_MONOID_INT64, C,
+                GrB_DESC_T0)) ;
+            GRB_TRY (GrB_Vector_setElement (p, source, source)) ;
+        }
+        else
+        {
+            // E may have zero-weight cycles, so use a BFS of E instead
+            LG_TRY (LAGraph_New (&Gtight, &E, LAGraph_ADJACENCY_DIRECTED,
+                msg)) ;
+            LG_TRY (LAGr_BreadthFirstSearch (NULL, &pbfs, Gtight, source,
+                msg)) ;
+            // the BFS parent is GrB_INT32 if n < 2^31; typecast to GrB_INT64
+            GRB_TRY (GrB_Vector_new (&p, GrB_INT64, n)) ;
+            GRB_TRY (GrB_apply (p, NULL, NULL, GrB_IDENTITY_INT64, pbfs,
+                NULL)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    if (parent != NULL)
+    {
+        (*parent) = p ;
+        p = NULL ;
+    }
+    if (path_length != NULL)
+    {
+        (*path_length) = t ;
+        t = NULL ;
+    }
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,748 @@
+//------------------------------------------------------------------------------
+// LG_TriangleCount: Triangle counting using various methods
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// Count the number of triangles in a graph, and optionally the number of
+// triangles incident on each node and each edge.  This is used by
+// LAGr_TriangleCount and LAGr_TriangleCountLocal.
+
+// This is an Advanced algorithm (G->nself_edges, G->out_degree,
+// G->is_symmetric_structure are required).
+
+// Given a symmetric graph A with no-self edges, LAGr_TriangleCount counts the
+// number of triangles in the graph.  A triangle is a clique of size three,
+// that is, 3 nodes that are all pairwise connected.
+
+// One of 6 methods are used, defined below where L and U are the strictly
+// lower and strictly upper triangular parts of the symmetrix matrix A,
+// respectively.  Each method computes the same result, ntri:
+
+//  0:  default:    use the default method (currently method Sandia_LUT)
+//  1:  Burkhardt:  ntri = sum (sum ((A^2) .* A)) / 6
+//  2:  Cohen:      ntri = sum (sum ((L * U) .* A)) / 2
+//  3:  Sandia_LL:  ntri = sum (sum ((L * L) .* L))
+//  4:  Sandia_UU:  ntri = sum (sum ((U * U) .* U))
+//  5:  Sandia_LUT: ntri = sum (sum ((L * U') .* L)).  Note that L=U'.
+//  6:  Sandia_ULT: ntri = sum (sum ((U * L') .* U)).  Note that U=L'.
+//  7:  Intersect:  ntri = sum (sum ((L * U') .* L)), the same as Sandia_LUT,
+//                  but computed without GraphBLAS by a set intersection of
+//                  the rows of L.
+
+// A is a square symmetric matrix, of any type.  Its values are ignored.
+// Results are undefined for methods 1 and 2 if self-edges exist in A.  Results
+// are undefined for all methods if A is unsymmetric.
+
+// The Sandia_* methods all tend to be faster than the Burkhardt or Cohen
+// methods.  For the largest graphs, Sandia_LUT tends to be fastest, except for
+// the GAP-urand matrix, where the saxpy-based Sandia_LL method (L*L.*L) is
+// fastest.  For many small graphs, the saxpy-based Sandia_LL and Sandia_UU
+// methods are often faster that the dot-product-based methods.  If the method
+// and presort have been calibrated for the graph by
+// LAGraph_TriangleCount_Calibrate (G->tc_method and G->tc_presort), they are
+// used in place of the AutoMethod and AutoSort heuristics below.
+
+// The Intersect method exports L = tril (A,-1) once, in CSR form with sorted
+// rows, and computes, for each entry L(i,j), the size of the intersection of
+// L(i,0:j-1) and L(j,:).  Each pair of lists is intersected with a merge if
+// their lengths are similar, or by galloping (exponential and binary search)
+// through the longer list for each entry of the shorter one if their lengths
+// differ by more than a factor of LG_TC_GALLOP_RATIO.  The rows are
+// distributed over the threads with OpenMP dynamic scheduling.  Like the
+// Sandia_LUT method, it is fastest when the graph is sorted by ascending
+// degree, since each node then keeps only its neighbors of lower degree in L,
+// and the lists are short.  This can be faster than the masked dot products of
+// Sandia_LUT for graphs with a skewed degree distribution (such as GAP-kron
+// and GAP-twitter), which are also the graphs sorted by the AutoSort rule.
+
+// The number of triangles incident on each edge (i,j) is the number of common
+// neighbors of i and j, (A*A').*A, which needs all three nodes of each
+// triangle, not just one ordering of them as in the Cohen and Sandia_*
+// methods.  If the per-node or per-edge counts are requested, each method
+// instead computes C<M> = A*A' with its own mask M, using the same saxpy or
+// dot product kernel as its count:
+
+//  1:  Burkhardt:  C<A> = A*A (saxpy)
+//  2:  Cohen:      C<A> = A*A (saxpy), the same as Burkhardt
+//  3:  Sandia_LL:  C<L> = A*A (saxpy)
+//  4:  Sandia_UU:  C<U> = A*A (saxpy)
+//  5:  Sandia_LUT: C<L> = A*A' (dot)
+//  6:  Sandia_ULT: C<U> = A*A' (dot)
+//  7:  Intersect:  C<L> = A*A' (dot), the same as Sandia_LUT
+
+// With the L or U mask, C holds the count for just one of (i,j) and (j,i),
+// which takes half the work of the full A mask.  Then ntri = sum (sum (C))/3
+// (or /6 for the A mask), the per-node count is half the sum of C(i,:) and
+// C(:,i) (or half the sum of C(i,:) for the A mask), and the per-edge count is
+// C+C' (or C itself for the A mask), with explicit zeros for edges in no
+// triangle so that it has the same structure as A.  If the matrix is
+// presorted, the results are permuted back to the original node ordering.
+
+// Reference for the Burkhardt method:  Burkhardt, Paul. "Graphing Trillions of
+// Triangles." Information Visualization 16, no. 3 (July 2017): 157–66.
+// https://doi.org/10.1177/1473871616666393.
+
+// Reference for the Cohen method:  J. Cohen, "Graph twiddling in a mapreduce
+// world," Computing in Science & Engineering, vol. 11, no. 4, pp. 29–41, 2009.
+// https://doi.org/10.1109/MCSE.2009.120
+
+// Reference for the "Sandia_*" methods: Wolf, Deveci, Berry, Hammond,
+// Rajamanickam, "Fast linear algebra- based triangle counting with
+// KokkosKernels", IEEE HPEC'17, https://dx.doi.org/10.1109/HPEC.2017.8091043
+
+#define LG_FREE_ALL             \
+{                               \
+    GrB_free (L) ;              \
+    GrB_free (U) ;              \
+}
+
+#include "LG_alg_internal.h"
+
+//------------------------------------------------------------------------------
+// LG_tricount_prep: construct L and U for LAGr_TriangleCount
+//------------------------------------------------------------------------------
+
+// This is also used by LAGr_KCliqueCount.
+
+int LG_tricount_prep
+(
+    GrB_Matrix *L,      // if present, compute L = tril (A,-1)
+    GrB_Matrix *U,      // if present, compute U = triu (A, 1)
+    GrB_Matrix A,       // input matrix
+    char *msg
+)
+{
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+
+    if (L != NULL)
+    {
+        // L = tril (A,-1)
+        GRB_TRY (GrB_Matrix_new (L, GrB_BOOL, n, n)) ;
+        GRB_TRY (GrB_select (*L, NULL, NULL, GrB_TRIL, A, (int64_t) (-1),
+            NULL)) ;
+        GRB_TRY (GrB_Matrix_wait (*L, GrB_MATERIALIZE)) ;
+    }
+
+    if (U != NULL)
+    {
+        // U = triu (A,1)
+        GRB_TRY (GrB_Matrix_new (U, GrB_BOOL, n, n)) ;
+        GRB_TRY (GrB_select (*U, NULL, NULL, GrB_TRIU, A, (int64_t) 1, NULL)) ;
+        GRB_TRY (GrB_Matrix_wait (*U, GrB_MATERIALIZE)) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// tricount_intersect_lists: size of the intersection of two sorted lists
+//------------------------------------------------------------------------------
+
+// lists whose lengths differ by more than this factor are intersected by
+// galloping through the longer list; otherwise they are merged
+#define LG_TC_GALLOP_RATIO 32
+
+static inline int64_t tricount_intersect_lists
+(
+    const GrB_Index *a, int64_t na,     // sorted list a, of length na
+    const GrB_Index *b, int64_t nb      // sorted list b, of length nb
+)
+{
+    if (na > nb)
+    {
+        // ensure a is the shorter list
+        const GrB_Index *t = a ; a = b ; b = t ;
+        int64_t nt = na ; na = nb ; nb = nt ;
+    }
+    if (na == 0) return (0) ;
+    int64_t count = 0 ;
+
+    if (nb > LG_TC_GALLOP_RATIO * na)
+    {
+        // gallop through b for each entry of a
+        int64_t lo = 0 ;
+        for (int64_t k = 0 ; k < na && lo < nb ; k++)
+        {
+            const GrB_Index x = a [k] ;
+            // exponential search: find hi with b [hi] >= x, or hi >= nb
+            int64_t hi = lo, step = 1 ;
+            while (hi < nb && b [hi] < x)
+            {
+                lo = hi + 1 ;
+                hi += step ;
+                step <<= 1 ;
+            }
+            // binary search: find the first b [lo] >= x in b [lo:hi]
+            hi = LAGRAPH_MIN (hi, nb) ;
+            while (lo < hi)
+            {
+                int64_t mid = (lo + hi) / 2 ;
+                if (b [mid] < x)
+                {
+                    lo = mid + 1 ;
+                }
+                else
+                {
+                    hi = mid ;
+                }
+            }
+            if (lo < nb && b [lo] == x)
+            {
+                count++ ;
+                lo++ ;
+            }
+        }
+    }
+    else
+    {
+        // merge a and b, without branches in the inner loop
+        int64_t pa = 0, pb = 0 ;
+        while (pa < na && pb < nb)
+        {
+            const GrB_Index x = a [pa] ;
+            const GrB_Index y = b [pb] ;
+            count += (x == y) ;
+            pa += (x <= y) ;
+            pb += (y <= x) ;
+        }
+    }
+    return (count) ;
+}
+
+//------------------------------------------------------------------------------
+// tricount_intersect: count triangles by set intersection of the rows of L
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                         \
+{                                           \
+    LAGraph_Free ((void **) &Lp, NULL) ;    \
+    LAGraph_Free ((void **) &Lj, NULL) ;    \
+    LAGraph_Free ((void **) &Lx, NULL) ;    \
+}
+
+static int tricount_intersect
+(
+    int64_t *ntriangles,    // # of triangles
+    GrB_Matrix L,           // L = tril (A,-1), which may be emptied on output
+    char *msg
+)
+{
+    GrB_Index *Lp = NULL, *Lj = NULL ;
+    void *Lx = NULL ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, L)) ;
+
+    //--------------------------------------------------------------------------
+    // get the contents of L in CSR form, with sorted rows
+    //--------------------------------------------------------------------------
+
+    #if LAGRAPH_SUITESPARSE
+    // unpack L, which is a temporary matrix, without copying it
+    GrB_Index Lp_size, Lj_size, Lx_size ;
+    bool L_iso ;
+    GRB_TRY (GxB_Matrix_unpack_CSR (L, &Lp, &Lj, &Lx, &Lp_size, &Lj_size,
+        &Lx_size, &L_iso, NULL, NULL)) ;
+    #else
+    GrB_Index Lp_len, Lj_len, Lx_len ;
+    GRB_TRY (GrB_Matrix_exportSize (&Lp_len, &Lj_len, &Lx_len, GrB_CSR_FORMAT,
+        L)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Lp, Lp_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Lj, Lj_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc (&Lx, Lx_len, sizeof (bool), msg)) ;
+    GRB_TRY (GrB_Matrix_export (Lp, Lj, (bool *) Lx, &Lp_len, &Lj_len,
+        &Lx_len, GrB_CSR_FORMAT, L)) ;
+    #endif
+
+    //--------------------------------------------------------------------------
+    // count the triangles
+    //--------------------------------------------------------------------------
+
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, n / 16) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    int64_t ntri = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1024) \
+        reduction(+:ntri)
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        const int64_t pstart = Lp [i] ;
+        const int64_t pend = Lp [i+1] ;
+        for (int64_t p = pstart ; p < pend ; p++)
+        {
+            // ntri += number of entries in both L(i,0:j-1) and L(j,:), where
+            // L(i,0:j-1) is Lj [pstart:p-1] since the rows of L are sorted
+            const int64_t j = Lj [p] ;
+            ntri += tricount_intersect_lists (Lj + pstart, p - pstart,
+                Lj + Lp [j], Lp [j+1] - Lp [j]) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_ALL ;
+    (*ntriangles) = ntri ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_TriangleCount: count the number of triangles in a graph
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                        \
+{                                           \
+    GrB_free (&C) ;                         \
+    GrB_free (&L) ;                         \
+    GrB_free (&T) ;                         \
+    GrB_free (&U) ;                         \
+    GrB_free (&t) ;                         \
+    LAGraph_Free ((void **) &P, NULL) ;     \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                     \
+{                                                       \
+    LG_FREE_WORK ;                                      \
+    if (ntri_vertex != NULL) GrB_free (ntri_vertex) ;   \
+    if (ntri_edge != NULL) GrB_free (ntri_edge) ;       \
+}
+
+int LG_TriangleCount
+(
+    // output:
+    uint64_t *ntriangles,       // # of triangles (optional; may be NULL)
+    GrB_Vector *ntri_vertex,    // # of triangles incident on each node
+                                // (optional; may be NULL)
+    GrB_Matrix *ntri_edge,      // # of triangles incident on each edge
+                                // (optional; may be NULL)
+    // input:
+    const LAGraph_Graph G,
+    LAGr_TriangleCount_Method *p_method,
+    LAGr_TriangleCount_Presort *p_presort,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix C = NULL, L = NULL, U = NULL, T = NULL ;
+    GrB_Vector t = NULL ;
+    int64_t *P = NULL ;
+    bool local = (ntri_vertex != NULL || ntri_edge != NULL) ;
+    if (ntri_vertex != NULL) (*ntri_vertex) = NULL ;
+    if (ntri_edge != NULL) (*ntri_edge) = NULL ;
+
+    // get the method
+    LAGr_TriangleCount_Method method ;
+    method = (p_method == NULL) ? LAGr_TriangleCount_AutoMethod : (*p_method) ;
+    LG_ASSERT_MSG (
+    method == LAGr_TriangleCount_AutoMethod ||  // 0: use auto method
+    method == LAGr_TriangleCount_Burkhardt  ||  // 1: sum (sum ((A^2) .* A))/6
+    method == LAGr_TriangleCount_Cohen      ||  // 2: sum (sum ((L * U) .*A))/2
+    method == LAGr_TriangleCount_Sandia_LL  ||  // 3: sum (sum ((L * L) .* L))
+    method == LAGr_TriangleCount_Sandia_UU  ||  // 4: sum (sum ((U * U) .* U))
+    method == LAGr_TriangleCount_Sandia_LUT ||  // 5: sum (sum ((L * U') .* L))
+    method == LAGr_TriangleCount_Sandia_ULT ||  // 6: sum (sum ((U * L') .* U))
+    method == LAGr_TriangleCount_Intersect,     // 7: as 5, by set intersection
+    GrB_INVALID_VALUE, "method is invalid") ;
+
+    // get the presort
+    LAGr_TriangleCount_Presort presort ;
+    presort = (p_presort == NULL) ? LAGr_TriangleCount_AutoSort : (*p_presort) ;
+    LG_ASSERT_MSG (
+    presort == LAGr_TriangleCount_NoSort     ||
+    presort == LAGr_TriangleCount_Ascending  ||
+    presort == LAGr_TriangleCount_Descending ||
+    presort == LAGr_TriangleCount_AutoSort,
+    GrB_INVALID_VALUE, "presort is invalid") ;
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (ntriangles != NULL || local, GrB_NULL_POINTER) ;
+    LG_ASSERT (G->nself_edges == 0, LAGRAPH_NO_SELF_EDGES_ALLOWED) ;
+
+    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)),
+        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
+        "G->A must be known to be symmetric") ;
+
+    // get the method and presort calibrated for this graph by
+    // LAGraph_TriangleCount_Calibrate, ignoring them if they are not valid
+    LAGr_TriangleCount_Method tc_method = LAGr_TriangleCount_AutoMethod ;
+    LAGr_TriangleCount_Presort tc_presort = LAGr_TriangleCount_AutoSort ;
+    if (G->tc_method >= LAGr_TriangleCount_Burkhardt &&
+        G->tc_method <= LAGr_TriangleCount_Intersect &&
+        G->tc_presort >= LAGr_TriangleCount_Descending &&
+        G->tc_presort <= LAGr_TriangleCount_NoSort)
+    {
+        tc_method = (LAGr_TriangleCount_Method) G->tc_method ;
+        tc_presort = (LAGr_TriangleCount_Presort) G->tc_presort ;
+    }
+
+    if (tc_method != LAGr_TriangleCount_AutoMethod &&
+        method == LAGr_TriangleCount_AutoMethod)
+    {
+        // use the method calibrated for this graph
+        method = tc_method ;
+    }
+
+    if (tc_method != LAGr_TriangleCount_AutoMethod && method == tc_method &&
+        presort == LAGr_TriangleCount_AutoSort)
+    {
+        // use the presort calibrated for this method
+        presort = tc_presort ;
+    }
+
+    if (method == LAGr_TriangleCount_AutoMethod)
+    {
+        // AutoMethod: use default, Sandia_LUT: sum (sum ((L * U') .* L))
+        method = LAGr_TriangleCount_Sandia_LUT ;
+    }
+
+    // only the Sandia_* methods can benefit from the presort
+    bool method_can_use_presort =
+    method == LAGr_TriangleCount_Sandia_LL || // sum (sum ((L * L) .* L))
+    method == LAGr_TriangleCount_Sandia_UU || // sum (sum ((U * U) .* U))
+    method == LAGr_TriangleCount_Sandia_LUT || // sum (sum ((L * U') .* L))
+    method == LAGr_TriangleCount_Sandia_ULT || // sum (sum ((U * L') .* U))
+    method == LAGr_TriangleCount_Intersect ; // as Sandia_LUT
+
+    GrB_Matrix A = G->A ;
+    GrB_Vector Degree = G->out_degree ;
+
+    bool auto_sort = (presort == LAGr_TriangleCount_AutoSort) ;
+    if (auto_sort && method_can_use_presort)
+    {
+        LG_ASSERT_MSG (Degree != NULL,
+            LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Matrix_new (&C, GrB_INT64, n, n)) ;
+    #if LAGRAPH_SUITESPARSE
+    GrB_Semiring semiring = GxB_PLUS_PAIR_INT64 ;
+    #else
+    GrB_Semiring semiring = LAGraph_plus_one_int64 ;
+    #endif
+    GrB_Monoid monoid = GrB_PLUS_MONOID_INT64 ;
+
+    //--------------------------------------------------------------------------
+    // heuristic sort rule
+    //--------------------------------------------------------------------------
+
+    if (!method_can_use_presort)
+    {
+        // no sorting for the Burkhardt and Cohen methods: presort parameter
+        // is ignored.
+        presort = LAGr_TriangleCount_NoSort ;
+    }
+    else if (auto_sort)
+    {
+        // auto selection of sorting method for Sandia_* methods
+        presort = LAGr_TriangleCount_NoSort ; // default is not to sort
+
+        if (method_can_use_presort)
+        {
+            // This rule is very similar to Scott Beamer's rule in the GAP TC
+            // benchmark, except that it is extended to handle the ascending
+            // sort needed by methods 3 and 5.  It also uses a stricter rule,
+            // since the performance of triangle counting in SuiteSparse:
+            // GraphBLAS is less sensitive to the sorting as compared to the
+            // GAP algorithm.  This is because the dot products in SuiteSparse:
+            // GraphBLAS use binary search if one vector is very sparse
+            // compared to the other.  As a result, SuiteSparse:GraphBLAS needs
+            // the sort for fewer matrices, as compared to the GAP algorithm.
+
+            // With this rule, the GAP-kron and GAP-twitter matrices are
+            // sorted, and the others remain unsorted.  With the rule in the
+            // GAP tc.cc benchmark, GAP-kron and GAP-twitter are sorted, and so
+            // is GAP-web, but GAP-web is not sorted here.
+
+            #define NSAMPLES 1000
+            GrB_Index nvals ;
+            GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+            if (n > NSAMPLES && ((double) nvals / ((double) n)) >= 10)
+            {
+                // estimate the mean and median degrees
+                double mean, median ;
+                LG_TRY (LAGr_SampleDegree (&mean, &median,
+                    G, true, NSAMPLES, n, msg)) ;
+                // sort if the average degree is very high vs the median
+                if (mean > 4 * median)
+                {
+                    switch (method)
+                    {
+                        case LAGr_TriangleCount_Sandia_LL:
+                            // 3:sum (sum ((L * L) .* L))
+                            presort = LAGr_TriangleCount_Ascending  ;
+                            break ;
+                        case LAGr_TriangleCount_Sandia_UU:
+                            // 4: sum (sum ((U * U) .* U))
+                            presort = LAGr_TriangleCount_Descending ;
+                            break ;
+                        default:
+                        case LAGr_TriangleCount_Sandia_LUT:
+                            // 5: sum (sum ((L * U') .* L))
+                            presort = LAGr_TriangleCount_Ascending  ;
+                            break ;
+                        case LAGr_TriangleCount_Sandia_ULT:
+                            // 6: sum (sum ((U * L') .* U))
+                            presort = LAGr_TriangleCount_Descending ;
+                            break ;
+                        case LAGr_TriangleCount_Intersect:
+                            // 7: same as Sandia_LUT
+                            presort = LAGr_TriangleCount_Ascending  ;
+                            break ;
+                    }
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the input matrix, if requested
+    //--------------------------------------------------------------------------
+
+    if (presort != LAGr_TriangleCount_NoSort)
+    {
+        // P = permutation that sorts the rows by their degree
+        LG_TRY (LAGr_SortByDegree (&P, G, true,
+            presort == LAGr_TriangleCount_Ascending, msg)) ;
+
+        // T = A (P,P) and typecast to boolean
+        GRB_TRY (GrB_Matrix_new (&T, GrB_BOOL, n, n)) ;
+        GRB_TRY (GrB_extract (T, NULL, NULL, A, (GrB_Index *) P, n,
+            (GrB_Index *) P, n, NULL)) ;
+        A = T ;
+
+        // free workspace, unless P is needed to unpermute the local counts
+        if (!local)
+        {
+            LG_TRY (LAGraph_Free ((void **) &P, NULL)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // count triangles
+    //--------------------------------------------------------------------------
+
+    int64_t ntri ;
+
+    if (local)
+    {
+
+        //----------------------------------------------------------------------
+        // count the triangles incident on each edge: C<M> = A*A'
+        //----------------------------------------------------------------------
+
+        GrB_Matrix M = A ;
+        switch (method)
+        {
+            case LAGr_TriangleCount_Burkhardt:  // 1: C<A> = A*A
+            case LAGr_TriangleCount_Cohen:      // 2: C<A> = A*A
+                GRB_TRY (GrB_mxm (C, A, NULL, semiring, A, A, GrB_DESC_S)) ;
+                break ;
+
+            case LAGr_TriangleCount_Sandia_LL:  // 3: C<L> = A*A
+                LG_TRY (LG_tricount_prep (&L, NULL, A, msg)) ;
+                M = L ;
+                GRB_TRY (GrB_mxm (C, L, NULL, semiring, A, A, GrB_DESC_S)) ;
+                break ;
+
+            case LAGr_TriangleCount_Sandia_UU:  // 4: C<U> = A*A
+                LG_TRY (LG_tricount_prep (NULL, &U, A, msg)) ;
+                M = U ;
+                GRB_TRY (GrB_mxm (C, U, NULL, semiring, A, A, GrB_DESC_S)) ;
+                break ;
+
+            default:
+            case LAGr_TriangleCount_Sandia_LUT: // 5: C<L> = A*A'
+                LG_TRY (LG_tricount_prep (&L, NULL, A, msg)) ;
+                M = L ;
+                GRB_TRY (GrB_mxm (C, L, NULL, semiring, A, A, GrB_DESC_ST1)) ;
+                break ;
+
+            case LAGr_TriangleCount_Sandia_ULT: // 6: C<U> = A*A'
+                LG_TRY (LG_tricount_prep (NULL, &U, A, msg)) ;
+                M = U ;
+                GRB_TRY (GrB_mxm (C, U, NULL, semiring, A, A, GrB_DESC_ST1)) ;
+                break ;
+        }
+
+        // each triangle appears 6 times in C<A>, or 3 times in C<L> or C<U>
+        bool half = (M != A) ;
+        GRB_TRY (GrB_reduce (&ntri, NULL, monoid, C, NULL)) ;
+        ntri /= (half ? 3 : 6) ;
+
+        if (ntri_vertex != NULL)
+        {
+            // t = sum (C,2) + sum (C,1)', or sum (C,2) for C<A>
+            GRB_TRY (GrB_Vector_new (&t, GrB_INT64, n)) ;
+            GRB_TRY (GrB_assign (t, NULL, NULL, (int64_t) 0, GrB_ALL, n,
+                NULL)) ;
+            GRB_TRY (GrB_reduce (t, NULL, GrB_PLUS_INT64, monoid, C, NULL)) ;
+            if (half)
+            {
+                GRB_TRY (GrB_reduce (t, NULL, GrB_PLUS_INT64, monoid, C,
+                    GrB_DESC_T0)) ;
+            }
+            // each triangle is counted on both of the edges incident on i
+            GRB_TRY (GrB_apply (t, NULL, NULL, GrB_DIV_INT64, t, (int64_t) 2,
+                NULL)) ;
+        }
+
+        if (ntri_edge != NULL)
+        {
+            if (half)
+            {
+                // C = C + C'
+                GRB_TRY (GrB_eWiseAdd (C, NULL, NULL, GrB_PLUS_INT64, C, C,
+                    GrB_DESC_T1)) ;
+            }
+            // C<struct(A)> += 0, so that C has the same structure as A
+            GRB_TRY (GrB_assign (C, A, GrB_PLUS_INT64, (int64_t) 0, GrB_ALL, n,
+                GrB_ALL, n, GrB_DESC_S)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // unpermute the results, if the matrix was presorted
+        //----------------------------------------------------------------------
+
+        if (P == NULL)
+        {
+            if (ntri_vertex != NULL)
+            {
+                (*ntri_vertex) = t ;
+                t = NULL ;
+            }
+            if (ntri_edge != NULL)
+            {
+                (*ntri_edge) = C ;
+                C = NULL ;
+            }
+        }
+        else
+        {
+            if (ntri_vertex != NULL)
+            {
+                // ntri_vertex (P) = t
+                GRB_TRY (GrB_Vector_new (ntri_vertex, GrB_INT64, n)) ;
+                GRB_TRY (GrB_assign (*ntri_vertex, NULL, NULL, t,
+                    (GrB_Index *) P, n, NULL)) ;
+            }
+            if (ntri_edge != NULL)
+            {
+                // ntri_edge (P,P) = C
+                GRB_TRY (GrB_Matrix_new (ntri_edge, GrB_INT64, n, n)) ;
+                GRB_TRY (GrB_assign (*ntri_edge, NULL, NULL, C,
+                    (GrB_Index *) P, n, (GrB_Index *) P, n, NULL)) ;
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // count the triangles
+        //----------------------------------------------------------------------
+
+        switch (method)
+        {
+
+            case LAGr_TriangleCount_Burkhardt:  // 1: sum (sum ((A^2) .* A)) / 6
+
+                GRB_TRY (GrB_mxm (C, A, NULL, semiring, A, A, GrB_DESC_S)) ;
+                GRB_TRY (GrB_reduce (&ntri, NULL, monoid, C, NULL)) ;
+                ntri /= 6 ;
+                break ;
+
+            case LAGr_TriangleCount_Cohen: // 2: sum (sum ((L * U) .* A)) / 2
+
+                LG_TRY (LG_tricount_prep (&L, &U, A, msg)) ;
+                GRB_TRY (GrB_mxm (C, A, NULL, semiring, L, U, GrB_DESC_S)) ;
+                GRB_TRY (GrB_reduce (&ntri, NULL, monoid, C, NULL)) ;
+                ntri /= 2 ;
+                break ;
+
+            case LAGr_TriangleCount_Sandia_LL: // 3: sum (sum ((L * L) .* L))
+
+                // using the masked saxpy3 method
+                LG_TRY (LG_tricount_prep (&L, NULL, A, msg)) ;
+                GRB_TRY (GrB_mxm (C, L, NULL, semiring, L, L, GrB_DESC_S)) ;
+                GRB_TRY (GrB_reduce (&ntri, NULL, monoid, C, NULL)) ;
+                break ;
+
+            case LAGr_TriangleCount_Sandia_UU: // 4: sum (sum ((U * U) .* U))
+
+                // using the masked saxpy3 method
+                LG_TRY (LG_tricount_prep (NULL, &U, A, msg)) ;
+                GRB_TRY (GrB_mxm (C, U, NULL, semiring, U, U, GrB_DESC_S)) ;
+                GRB_TRY (GrB_reduce (&ntri, NULL, monoid, C, NULL)) ;
+                break ;
+
+            default:
+            case LAGr_TriangleCount_Sandia_LUT: // 5: sum (sum ((L * U') .* L))
+
+                // This tends to be the fastest method for most large
+                // matrices, but the Sandia_ULT method is also very fast.
+
+                // using the masked dot product
+                LG_TRY (LG_tricount_prep (&L, &U, A, msg)) ;
+                GRB_TRY (GrB_mxm (C, L, NULL, semiring, L, U, GrB_DESC_ST1)) ;
+                GRB_TRY (GrB_reduce (&ntri, NULL, monoid, C, NULL)) ;
+                break ;
+
+            case LAGr_TriangleCount_Sandia_ULT: // 6: sum (sum ((U * L') .* U))
+
+                // using the masked dot product
+                LG_TRY (LG_tricount_prep (&L, &U, A, msg)) ;
+                GRB_TRY (GrB_mxm (C, U, NULL, semiring, U, L, GrB_DESC_ST1)) ;
+                GRB_TRY (GrB_reduce (&ntri, NULL, monoid, C, NULL)) ;
+                break ;
+
+            case LAGr_TriangleCount_Intersect: // 7: same as Sandia_LUT
+
+                // using set intersection, outside of GraphBLAS
+                LG_TRY (LG_tricount_prep (&L, NULL, A, msg)) ;
+                LG_TRY (tricount_intersect (&ntri, L, msg)) ;
+                break ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    if (p_method != NULL) (*p_method) = method ;
+    if (p_presort != NULL) (*p_presort) = presort ;
+    if (ntriangles != NULL) (*ntriangles) = (uint64_t) ntri ;
+    return (GrB_SUCCESS) ;
+}
@@ -28,6 +28,7 @@ int LG_BreadthFirstSearch_SSGrB
     // output:
     GrB_Vector    *level,
     GrB_Vector    *parent,
+    GrB_Vector    *direction,   // optional; may be NULL
     // input:
     const LAGraph_Graph G,
     GrB_Index      src,
@@ -45,6 +46,52 @@ int LG_BreadthFirstSearch_vanilla
     char          *msg
 ) ;
 
+int LG_SingleSourceShortestPath
+(
+    // output:
+    GrB_Vector *path_length,
+    GrB_Vector *parent,         // optional; may be NULL
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index source,
+    GrB_Scalar Delta,           // delta value for delta stepping
+    bool adaptive,              // if true, adapt the bucket width
+    char *msg
+) ;
+
+int LG_Betweenness
+(
+    // output:
+    GrB_Vector *centrality,         // vertex centrality (optional; may be NULL)
+    GrB_Matrix *edge_centrality,    // edge centrality (optional; may be NULL)
+    // input:
+    const LAGraph_Graph G,
+    const GrB_Index *sources,       // source vertices to compute shortest paths
+    int32_t ns,                     // number of source vertices
+    char *msg
+) ;
+
+int LG_TriangleCount
+(
+    // output:
+    uint64_t *ntriangles,           // # of triangles (optional; may be NULL)
+    GrB_Vector *ntri_vertex,        // # triangles per node (optional)
+    GrB_Matrix *ntri_edge,          // # triangles per edge (optional)
+    // input:
+    const LAGraph_Graph G,
+    LAGr_TriangleCount_Method *p_method,
+    LAGr_TriangleCount_Presort *p_presort,
+    char *msg
+) ;
+
+int LG_tricount_prep
+(
+    GrB_Matrix *L,      // if present, compute L = tril (A,-1)
+    GrB_Matrix *U,      // if present, compute U = triu (A, 1)
+    GrB_Matrix A,       // input matrix
+    char *msg
+) ;
+
 int LG_CC_FastSV6           // SuiteSparse:GraphBLAS method, with GxB extensions
 (
     // output:
@@ -57,7 +57,7 @@ int main (int argc, char **argv)
         printf ("Matrix file not found: [%s]\n", argv [1]) ;
         exit (1) ;
     }
-    LAGRAPH_TRY (LAGraph_MMRead (&A, f, msg)) ;
+    LAGRAPH_TRY (LAGr_MMRead (&A, f, LAGRAPH_MM_BLOCKSIZE, msg)) ;
     fclose (f) ;
 
     GRB_TRY (GrB_wait (A, GrB_MATERIALIZE)) ;
@@ -55,6 +55,7 @@ char *method_name (int method, int sorting)
         case LAGr_TriangleCount_Sandia_UU:  s = "Sandia_UU: sum ((U*U) .* U)    " ; break ;
         case LAGr_TriangleCount_Sandia_LUT: s = "Sandia_LUT: sum ((L*U') .* L)  " ; break ;
         case LAGr_TriangleCount_Sandia_ULT: s = "Sandia_ULT: sum ((U*L') .* U)  " ; break ;
+        case LAGr_TriangleCount_Intersect:  s = "Intersect: sum ((L*U') .* L)   " ; break ;
         default: abort ( ) ;
     }
 
@@ -182,9 +183,10 @@ int main (int argc, char **argv)
     // just try methods 5 and 6
     // for (int method = 5 ; method <= 6 ; method++)
 
-    // try all methods 3 to 5
-    for (int method = 3 ; method <= 5 ; method++)
+    // try all methods 3 to 5, and 7
+    for (int method = 3 ; method <= 7 ; method++)
     {
+        if (method == LAGr_TriangleCount_Sandia_ULT) continue ;
         // for (int sorting = -1 ; sorting <= 2 ; sorting++)
 
         int sorting = LAGr_TriangleCount_AutoSort ; // just use auto-sort
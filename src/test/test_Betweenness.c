@@ -274,6 +274,203 @@ void test_bc (void)
     LAGraph_Finalize (msg) ;
 }
 
+//------------------------------------------------------------------------------
+// test_bc_exact: test LAGraph_Betweenness
+//------------------------------------------------------------------------------
+
+// max (abs (x-y))
+float exact_difference (GrB_Vector x, GrB_Vector y) ;
+
+float exact_difference (GrB_Vector x, GrB_Vector y)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, x)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP64, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP64, x, y, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP64, diff, NULL)) ;
+    double err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP64, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return ((float) err) ;
+}
+
+void test_bc_exact (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector centrality = NULL, c2 = NULL ;
+    GrB_Index *sources = NULL ;
+    int nthreads_outer, nthreads_inner ;
+    OK (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+
+    const char *files [3] = { "karate.mtx", "west0067.mtx", "" } ;
+    LAGraph_Kind kinds [2] = { LAGraph_ADJACENCY_UNDIRECTED,
+        LAGraph_ADJACENCY_DIRECTED } ;
+
+    for (int k = 0 ; strlen (files [k]) > 0 ; k++)
+    {
+        snprintf (filename, LEN, LG_DATA_DIR "%s", files [k]) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, kinds [k], msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        // c2 = betweenness with all sources in a single batch
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        sources = malloc (n * sizeof (GrB_Index)) ;
+        for (int64_t i = 0 ; i < n ; i++) sources [i] = i ;
+        OK (LAGr_Betweenness (&c2, G, sources, (int32_t) n, msg)) ;
+        free (sources) ;
+
+        // known results for karate, where each pair (s,t) is counted in
+        // both directions
+        if (k == 0)
+        {
+            double c0 = 0, c33 = 0 ;
+            OK (GrB_Vector_extractElement (&c0, c2, 0)) ;
+            OK (GrB_Vector_extractElement (&c33, c2, 33)) ;
+            printf ("\nkarate exact bc: %g %g\n", c0, c33) ;
+            TEST_CHECK (fabs (c0  - 2 * 231.0714) < 1e-3) ;
+            TEST_CHECK (fabs (c33 - 2 * 160.1381) < 1e-3) ;
+        }
+
+        // try a few memory budgets, with 1 and 2 outer threads
+        size_t budgets [4] = { 0, 1, 3*64*n, 10*64*n } ;
+        for (int nouter = 1 ; nouter <= 2 ; nouter++)
+        {
+            OK (LAGraph_SetNumThreads (nouter, nthreads_inner, msg)) ;
+            for (int kk = 0 ; kk < 4 ; kk++)
+            {
+                OK (LAGraph_Betweenness (&centrality, G, budgets [kk], msg)) ;
+                float err = exact_difference (centrality, c2) ;
+                printf ("%s: outer %d budget %g: err %e\n", files [k], nouter,
+                    (double) budgets [kk], err) ;
+                TEST_CHECK (err < 1e-6) ;
+                OK (GrB_free (&centrality)) ;
+            }
+        }
+        OK (LAGraph_SetNumThreads (nthreads_outer, nthreads_inner, msg)) ;
+
+        OK (GrB_free (&c2)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    TEST_CHECK (LAGraph_Betweenness (NULL, G, 0, msg) == GrB_NULL_POINTER) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_bc_edge: edge betweenness centrality
+//------------------------------------------------------------------------------
+
+void test_bc_edge (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, E = NULL, ET = NULL ;
+    GrB_Vector level = NULL ;
+    GrB_Index *sources = NULL ;
+
+    const char *files [3] = { "karate.mtx", "west0067.mtx", "" } ;
+    LAGraph_Kind kinds [2] = { LAGraph_ADJACENCY_UNDIRECTED,
+        LAGraph_ADJACENCY_DIRECTED } ;
+
+    for (int k = 0 ; strlen (files [k]) > 0 ; k++)
+    {
+        snprintf (filename, LEN, LG_DATA_DIR "%s", files [k]) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, kinds [k], msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        GrB_Index n, nvals, anvals ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        // E = edge betweenness, with all nodes as sources
+        sources = malloc (n * sizeof (GrB_Index)) ;
+        for (int64_t i = 0 ; i < n ; i++) sources [i] = i ;
+        OK (LAGr_EdgeBetweenness (&E, G, sources, (int32_t) n, msg)) ;
+        free (sources) ;
+
+        // E has the same structure as A
+        OK (GrB_Matrix_nvals (&nvals, E)) ;
+        OK (GrB_Matrix_nvals (&anvals, G->A)) ;
+        TEST_CHECK (nvals == anvals) ;
+
+        // Each shortest path from s to t traverses dist(s,t) edges, so the
+        // sum of E is the sum of dist(s,t) over all pairs (s,t), counted
+        // twice if the graph is undirected.
+        double esum = 0, dsum = 0 ;
+        OK (GrB_reduce (&esum, NULL, GrB_PLUS_MONOID_FP64, E, NULL)) ;
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            double d = 0 ;
+            OK (LAGr_BreadthFirstSearch (&level, NULL, G, i, msg)) ;
+            OK (GrB_reduce (&d, NULL, GrB_PLUS_MONOID_FP64, level, NULL)) ;
+            dsum += d ;
+            OK (GrB_free (&level)) ;
+        }
+        if (k == 0) dsum *= 2 ;
+        printf ("\n%s: edge bc sum %g, distance sum %g\n", files [k],
+            esum, dsum) ;
+        TEST_CHECK (fabs (esum - dsum) < 1e-6 * dsum) ;
+
+        // E is symmetric for an undirected graph
+        if (k == 0)
+        {
+            OK (GrB_Matrix_new (&ET, GrB_FP64, n, n)) ;
+            OK (GrB_transpose (ET, NULL, NULL, E, NULL)) ;
+            OK (GrB_eWiseAdd (ET, NULL, NULL, GrB_MINUS_FP64, ET, E, NULL)) ;
+            OK (GrB_apply (ET, NULL, NULL, GrB_ABS_FP64, ET, NULL)) ;
+            double err = 0 ;
+            OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP64, ET, NULL)) ;
+            TEST_CHECK (err < 1e-10) ;
+            OK (GrB_free (&ET)) ;
+        }
+
+        OK (GrB_free (&E)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    // a directed path 0->1->2: E(0,1) = 2 (for 0->1 and 0->2), E(1,2) = 2
+    // (for 0->2 and 1->2)
+    GrB_Index I [2] = { 0, 1 }, J [2] = { 1, 2 }, src [3] = { 0, 1, 2 } ;
+    bool X [2] = { true, true } ;
+    OK (GrB_Matrix_new (&A, GrB_BOOL, 3, 3)) ;
+    OK (GrB_Matrix_build (A, I, J, X, 2, GrB_LOR)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    // G->AT is required
+    int result = LAGr_EdgeBetweenness (&E, G, src, 3, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (E == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+
+    OK (LAGr_EdgeBetweenness (&E, G, src, 3, msg)) ;
+    double e01 = 0, e12 = 0 ;
+    OK (GrB_Matrix_extractElement (&e01, E, 0, 1)) ;
+    OK (GrB_Matrix_extractElement (&e12, E, 1, 2)) ;
+    TEST_CHECK (e01 == 2 && e12 == 2) ;
+    OK (GrB_free (&E)) ;
+
+    // invalid source
+    src [0] = 3 ;
+    result = LAGr_EdgeBetweenness (&E, G, src, 1, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (E == NULL) ;
+
+    result = LAGr_EdgeBetweenness (NULL, G, src, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
 //------------------------------------------------------------------------------
 // test_bc_brutal: test BetweenessCentraliy with brutal malloc debugging
 //------------------------------------------------------------------------------
@@ -318,6 +515,8 @@ void test_bc_brutal (void)
 
 TEST_LIST = {
     {"test_bc", test_bc},
+    {"test_bc_exact", test_bc_exact},
+    {"test_bc_edge", test_bc_edge},
     #if LAGRAPH_SUITESPARSE
     {"test_bc_brutal", test_bc_brutal },
     #endif
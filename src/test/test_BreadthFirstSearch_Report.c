@@ -0,0 +1,239 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/test/test_BreadthFirstSearch_Report.c: test BFS report/calibrate
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// test LAGr_BreadthFirstSearch_Report and LAGraph_BreadthFirstSearch_Calibrate
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector level = NULL, level2 = NULL, parent = NULL, direction = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "A.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "bcsstk13.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "cryg2500.mtx",
+    LAGRAPH_UNKNOWN,              ""
+} ;
+
+//------------------------------------------------------------------------------
+// setup: start a test
+//------------------------------------------------------------------------------
+
+void setup (void)
+{
+    OK (LAGraph_Init (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// teardown: finalize a test
+//------------------------------------------------------------------------------
+
+void teardown (void)
+{
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// check_report: run the BFS with a report and check the result
+//------------------------------------------------------------------------------
+
+void check_report (GrB_Index src, bool push_only)
+{
+    OK (LAGr_BreadthFirstSearch_Report (&level, &parent, &direction, G, src,
+        msg)) ;
+    OK (LG_check_bfs (level, parent, G, src, msg)) ;
+
+    // the level is the same as LAGr_BreadthFirstSearch
+    bool ok = false ;
+    OK (LAGr_BreadthFirstSearch (&level2, NULL, G, src, msg)) ;
+    OK (LAGraph_Vector_IsEqual (&ok, level, level2, msg)) ;
+    TEST_CHECK (ok) ;
+
+    // direction (1:nlevels) is present, and direction (0) is not
+    int64_t nlevels = 0 ;
+    GrB_Index size, nvals, npull = 0 ;
+    OK (GrB_reduce (&nlevels, NULL, GrB_MAX_MONOID_INT64, level, NULL)) ;
+    OK (GrB_Vector_size (&size, direction)) ;
+    OK (GrB_Vector_nvals (&nvals, direction)) ;
+    TEST_CHECK (size == nlevels + 1) ;
+    TEST_CHECK (nvals == nlevels) ;
+    bool x ;
+    TEST_CHECK (GrB_Vector_extractElement_BOOL (&x, direction, 0)
+        == GrB_NO_VALUE) ;
+    OK (GrB_reduce (&npull, NULL, GrB_PLUS_MONOID_INT64, direction, NULL)) ;
+    printf ("src %g levels: %g pull levels: %g\n", (double) src,
+        (double) nlevels, (double) npull) ;
+    if (push_only)
+    {
+        TEST_CHECK (npull == 0) ;
+    }
+
+    OK (GrB_free (&level)) ;
+    OK (GrB_free (&level2)) ;
+    OK (GrB_free (&parent)) ;
+    OK (GrB_free (&direction)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BreadthFirstSearch_Report
+//------------------------------------------------------------------------------
+
+void test_BreadthFirstSearch_Report (void)
+{
+    setup ( ) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the graph
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        // the thresholds are not yet calibrated
+        TEST_CHECK (G->bfs_alpha == LAGRAPH_UNKNOWN) ;
+        TEST_CHECK (G->bfs_beta1 == LAGRAPH_UNKNOWN) ;
+        TEST_CHECK (G->bfs_beta2 == LAGRAPH_UNKNOWN) ;
+
+        // without G->out_degree, the BFS is push-only
+        for (GrB_Index src = 0 ; src < n ; src += LAGRAPH_MAX (1, n/4))
+        {
+            check_report (src, true) ;
+        }
+
+        // calibrate the thresholds, which also computes G->out_degree
+        OK (LAGraph_BreadthFirstSearch_Calibrate (G, 3, 42, msg)) ;
+        OK (LAGraph_CheckGraph (G, msg)) ;
+        printf ("alpha: %g beta1: %g beta2: %g\n", G->bfs_alpha,
+            G->bfs_beta1, G->bfs_beta2) ;
+        TEST_CHECK (G->bfs_alpha > 0) ;
+        TEST_CHECK (G->bfs_beta1 > 0) ;
+        TEST_CHECK (G->bfs_beta2 > 0) ;
+        // beta1 is the default, or one of the candidates tried by the probe
+        TEST_CHECK (G->bfs_beta1 == 8 || G->bfs_beta1 == 2 ||
+            G->bfs_beta1 == 32) ;
+        #if LAGRAPH_SUITESPARSE
+        TEST_CHECK (G->out_degree != NULL) ;
+        #endif
+        OK (LAGraph_Graph_Print (G, LAGraph_SHORT, stdout, msg)) ;
+
+        // calibrating again does nothing
+        double alpha = G->bfs_alpha ;
+        double beta1 = G->bfs_beta1 ;
+        double beta2 = G->bfs_beta2 ;
+        OK (LAGraph_BreadthFirstSearch_Calibrate (G, 3, 99, msg)) ;
+        TEST_CHECK (G->bfs_alpha == alpha) ;
+        TEST_CHECK (G->bfs_beta1 == beta1) ;
+        TEST_CHECK (G->bfs_beta2 == beta2) ;
+
+        // the BFS is still correct with the calibrated thresholds
+        for (GrB_Index src = 0 ; src < n ; src += LAGRAPH_MAX (1, n/4))
+        {
+            #if LAGRAPH_SUITESPARSE
+            check_report (src, false) ;
+            #else
+            check_report (src, true) ;
+            #endif
+        }
+
+        // deleting the cached properties clears the thresholds
+        OK (LAGraph_DeleteCached (G, msg)) ;
+        TEST_CHECK (G->bfs_alpha == LAGRAPH_UNKNOWN) ;
+        TEST_CHECK (G->bfs_beta1 == LAGRAPH_UNKNOWN) ;
+        TEST_CHECK (G->bfs_beta2 == LAGRAPH_UNKNOWN) ;
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    teardown ( ) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BreadthFirstSearch_Report_errors
+//------------------------------------------------------------------------------
+
+void test_BreadthFirstSearch_Report_errors (void)
+{
+    setup ( ) ;
+
+    int result = LAGraph_BreadthFirstSearch_Calibrate (NULL, 1, 0, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    // direction is NULL
+    result = LAGr_BreadthFirstSearch_Report (&level, NULL, NULL, G, 0, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    TEST_CHECK (level == NULL) ;
+
+    // level and parent are NULL
+    result = LAGr_BreadthFirstSearch_Report (NULL, NULL, &direction, G, 0,
+        msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    TEST_CHECK (direction == NULL) ;
+
+    // invalid source
+    result = LAGr_BreadthFirstSearch_Report (&level, &parent, &direction, G,
+        34, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (level == NULL && parent == NULL && direction == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    teardown ( ) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"BreadthFirstSearch_Report", test_BreadthFirstSearch_Report},
+    {"BreadthFirstSearch_Report_errors", test_BreadthFirstSearch_Report_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,220 @@
+//----------------------------------------------------------------------------
+// LAGraph/src/test/test_KCliqueCount.c: test cases for k-clique counting
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    uint64_t ntriangles ;           // # triangles in original matrix
+    const char *name ;              // matrix filename
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    {     45, "karate.mtx" },
+    {     11, "A.mtx" },
+    {   2016, "jagmesh7.mtx" },
+    {      6, "ldbc-cdlp-undirected-example.mtx" },
+    {      4, "ldbc-undirected-example.mtx" },
+    {      5, "ldbc-wcc-example.mtx" },
+    {      0, "LFAT5.mtx" },
+    { 342300, "bcsstk13.mtx" },
+    {      0, "tree-example.mtx" },
+    {      0, "" },
+} ;
+
+// graphs larger than this are not checked by brute force
+#define BRUTE_MAX 1200
+
+//****************************************************************************
+// brute_force: count the r-cliques in a list of nodes, with a dense matrix
+//****************************************************************************
+
+// The candidates in C are in ascending order, and each clique is counted once
+// by adding its nodes in ascending order.
+
+static uint64_t brute_force
+(
+    const bool *Adj,            // dense n-by-n adjacency matrix
+    int64_t n,
+    const int64_t *C,           // candidate nodes
+    int64_t nc,                 // # of candidates
+    int r                       // size of the cliques to count
+)
+{
+    if (r == 0) return (1) ;
+    uint64_t count = 0 ;
+    int64_t *Cnew = NULL ;
+    OK (LAGraph_Malloc ((void **) &Cnew, nc + 1, sizeof (int64_t), msg)) ;
+    for (int64_t k = 0 ; k < nc ; k++)
+    {
+        // Cnew = nodes in C(k+1:nc-1) adjacent to C(k)
+        int64_t v = C [k], nnew = 0 ;
+        for (int64_t t = k+1 ; t < nc ; t++)
+        {
+            if (Adj [v*n + C [t]]) Cnew [nnew++] = C [t] ;
+        }
+        count += brute_force (Adj, n, Cnew, nnew, r-1) ;
+    }
+    OK (LAGraph_Free ((void **) &Cnew, msg)) ;
+    return (count) ;
+}
+
+//****************************************************************************
+
+void test_KCliqueCount (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int kk = 0 ; ; kk++)
+    {
+
+        // load the graph
+        const char *aname = files [kk].name ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", kk, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+        GrB_Index n, nvals ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+
+        // 1-cliques, 2-cliques, and triangles
+        uint64_t ncliques = 0 ;
+        OK (LAGr_KCliqueCount (&ncliques, G, 1, msg)) ;
+        TEST_CHECK (ncliques == n) ;
+        OK (LAGr_KCliqueCount (&ncliques, G, 2, msg)) ;
+        TEST_CHECK (ncliques == (nvals - G->nself_edges) / 2) ;
+        OK (LAGr_KCliqueCount (&ncliques, G, 3, msg)) ;
+        printf ("# triangles: %" PRIu64 "\n", ncliques) ;
+        TEST_CHECK (ncliques == files [kk].ntriangles) ;
+
+        // larger cliques
+        bool *Adj = NULL ;
+        int64_t *C = NULL ;
+        if (n <= BRUTE_MAX)
+        {
+            // Adj = dense adjacency matrix, with no self-edges
+            GrB_Index *I = NULL, *J = NULL ;
+            OK (LAGraph_Calloc ((void **) &Adj, n*n, sizeof (bool), msg)) ;
+            OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg));
+            OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg));
+            OK (GrB_Matrix_extractTuples (I, J, (bool *) NULL, &nvals,
+                G->A)) ;
+            for (int64_t p = 0 ; p < nvals ; p++)
+            {
+                if (I [p] != J [p]) Adj [I [p] * n + J [p]] = true ;
+            }
+            OK (LAGraph_Free ((void **) &I, msg)) ;
+            OK (LAGraph_Free ((void **) &J, msg)) ;
+            OK (LAGraph_Malloc ((void **) &C, n, sizeof (int64_t), msg)) ;
+            for (int64_t i = 0 ; i < n ; i++) C [i] = i ;
+        }
+
+        for (int k = 4 ; k <= 6 ; k++)
+        {
+            OK (LAGr_KCliqueCount (&ncliques, G, k, msg)) ;
+            printf ("# %d-cliques: %" PRIu64 "\n", k, ncliques) ;
+            if (Adj != NULL)
+            {
+                uint64_t nbrute = brute_force (Adj, n, C, n, k) ;
+                TEST_CHECK (ncliques == nbrute) ;
+            }
+        }
+
+        OK (LAGraph_Free ((void **) &Adj, msg)) ;
+        OK (LAGraph_Free ((void **) &C, msg)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//****************************************************************************
+
+void test_KCliqueCount_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    uint64_t ncliques = 0 ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    // G must be symmetric
+    int result = LAGr_KCliqueCount (&ncliques, G, 4, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    // G->out_degree is missing
+    result = LAGr_KCliqueCount (&ncliques, G, 4, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    // invalid k
+    result = LAGr_KCliqueCount (&ncliques, G, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    result = LAGr_KCliqueCount (NULL, G, 4, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // no 8-cliques in the karate graph
+    OK (LAGr_KCliqueCount (&ncliques, G, 8, msg)) ;
+    TEST_CHECK (ncliques == 0) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"KCliqueCount", test_KCliqueCount},
+    {"KCliqueCount_errors", test_KCliqueCount_errors},
+    {NULL, NULL}
+};
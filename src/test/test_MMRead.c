@@ -368,6 +368,123 @@ void test_MMRead_failures (void)
     teardown ( ) ;
 }
 
+//-----------------------------------------------------------------------------
+// test_MMRead_blocks: test LAGr_MMRead with a range of block sizes
+//-----------------------------------------------------------------------------
+
+const size_t blocksizes [ ] = { 1, 7, 100, 4096, 1024*1024, 0 } ;
+
+void test_MMRead_blocks (void)
+{
+    setup ( ) ;
+
+    // input arguments are NULL
+    TEST_CHECK (LAGr_MMRead (NULL, NULL, 4096, msg) == GrB_NULL_POINTER) ;
+    TEST_CHECK (LAGr_MMRead (&A, NULL, 4096, msg) == GrB_NULL_POINTER) ;
+
+    // each matrix read in blocks must match the matrix read line-by-line
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (LAGraph_Matrix_TypeName (atype_name, A, msg)) ;
+        for (int b = 0 ; blocksizes [b] > 0 ; b++)
+        {
+            rewind (f) ;
+            OK (LAGr_MMRead (&B, f, blocksizes [b], msg)) ;
+            OK (LAGraph_Matrix_TypeName (btype_name, B, msg)) ;
+            TEST_CHECK (MATCHNAME (atype_name, btype_name)) ;
+            bool ok ;
+            OK (LAGraph_Matrix_IsEqual (&ok, A, B, msg)) ;
+            TEST_CHECK (ok) ;
+            TEST_MSG ("Failed test for equality, file: %s blocksize: %g\n",
+                aname, (double) blocksizes [b]) ;
+            OK (GrB_free (&B)) ;
+        }
+        OK (fclose (f)) ;
+        OK (GrB_free (&A)) ;
+    }
+
+    // mangled matrices must give the same errors when read in blocks
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = mangled_files [k].name ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        int error = mangled_files [k].error ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        for (int b = 0 ; blocksizes [b] > 0 ; b++)
+        {
+            rewind (f) ;
+            int status = LAGr_MMRead (&A, f, blocksizes [b], msg) ;
+            printf ("error expected: %d %d [%s]\n", error, status, msg) ;
+            TEST_CHECK (status == error) ;
+            TEST_CHECK (A == NULL) ;
+        }
+        OK (fclose (f)) ;
+    }
+
+    // a line that does not fit in MAXLINE characters is an error
+    FILE *f = tmpfile ( ) ;
+    TEST_CHECK (f != NULL) ;
+    fprintf (f, "%%%%MatrixMarket matrix coordinate real general\n") ;
+    fprintf (f, "2 2 2\n1 1 ") ;
+    for (int k = 0 ; k < 2*MMLEN ; k++) fputc ('1', f) ;
+    fprintf (f, "\n2 2 1\n") ;
+    for (int b = 0 ; blocksizes [b] > 0 ; b++)
+    {
+        rewind (f) ;
+        int status = LAGr_MMRead (&A, f, blocksizes [b], msg) ;
+        printf ("error expected: %d %d [%s]\n", LAGRAPH_IO_ERROR, status,
+            msg) ;
+        TEST_CHECK (status == LAGRAPH_IO_ERROR) ;
+        TEST_CHECK (A == NULL) ;
+    }
+    OK (fclose (f)) ;
+
+    // long comments, long blank lines, and entries with long trailing spaces
+    // are read the same in blocks as line-by-line
+    f = tmpfile ( ) ;
+    TEST_CHECK (f != NULL) ;
+    fprintf (f, "%%%%MatrixMarket matrix coordinate real general\n") ;
+    fprintf (f, "3 3 3\n%% a long comment:") ;
+    for (int k = 0 ; k < 3*MMLEN ; k++) fputc ('x', f) ;
+    fprintf (f, "\n1 1 4.5") ;
+    for (int k = 0 ; k < 2*MMLEN ; k++) fputc (' ', f) ;
+    fprintf (f, "\r\n") ;
+    for (int k = 0 ; k < 2*MMLEN ; k++) fputc (' ', f) ;
+    fprintf (f, "\n2 3 -1\n%%") ;
+    for (int k = 0 ; k < 2*MMLEN ; k++) fputc ('7', f) ;
+    fprintf (f, "\n3 2 8\n") ;
+    rewind (f) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    TEST_CHECK (nvals == 3) ;
+    for (int b = 0 ; blocksizes [b] > 0 ; b++)
+    {
+        rewind (f) ;
+        OK (LAGr_MMRead (&B, f, blocksizes [b], msg)) ;
+        bool ok ;
+        OK (LAGraph_Matrix_IsEqual (&ok, A, B, msg)) ;
+        TEST_CHECK (ok) ;
+        TEST_MSG ("Failed test for long lines, blocksize: %g\n",
+            (double) blocksizes [b]) ;
+        OK (GrB_free (&B)) ;
+    }
+    OK (GrB_free (&A)) ;
+    OK (fclose (f)) ;
+
+    teardown ( ) ;
+}
+
 //-----------------------------------------------------------------------------
 // test_jumbled: test reading a jumbled matrix
 //-----------------------------------------------------------------------------
@@ -772,6 +889,7 @@ TEST_LIST =
     { "MMRead", test_MMRead },
     { "karate", test_karate },
     { "MMRead_failures", test_MMRead_failures },
+    { "MMRead_blocks", test_MMRead_blocks },
     { "jumbled", test_jumbled },
     { "MMWrite", test_MMWrite },
     { "MMWrite_failures", test_MMWrite_failures },
@@ -67,6 +67,60 @@ const matrix_info files [ ] =
     { "" },
 } ;
 
+//****************************************************************************
+// check_parent: check the parent vector of a shortest path tree
+//****************************************************************************
+
+void check_parent (GrB_Vector path_length, GrB_Vector parent, GrB_Index src)
+{
+    GrB_Index n, nvals ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+    OK (GrB_Vector_nvals (&nvals, parent)) ;
+
+    // the parent vector is always GrB_INT64
+    char type_name [LAGRAPH_MAX_NAME_LEN] ;
+    OK (LAGraph_Vector_TypeName (type_name, parent, msg)) ;
+    TEST_CHECK (strcmp (type_name, "int64_t") == 0) ;
+    int64_t nreach = 0 ;
+    for (int64_t j = 0 ; j < n ; j++)
+    {
+        int64_t p = -1 ;
+        double tj = 0 ;
+        OK (GrB_Vector_extractElement_FP64 (&tj, path_length, j)) ;
+        int info = GrB_Vector_extractElement_INT64 (&p, parent, j) ;
+        bool reachable = (j == src) || !(isinf (tj) ||
+            tj == (double) INT32_MAX || tj == (double) INT64_MAX ||
+            tj == (double) UINT32_MAX || tj == (double) UINT64_MAX) ;
+        if (!reachable)
+        {
+            // unreachable nodes have no parent
+            TEST_CHECK (info == GrB_NO_VALUE) ;
+            continue ;
+        }
+        nreach++ ;
+        OK (info) ;
+        if (j == src)
+        {
+            TEST_CHECK (p == (int64_t) src) ;
+            continue ;
+        }
+        // the edge (p,j) is on a shortest path to j
+        double tp = 0, apj = 0 ;
+        OK (GrB_Vector_extractElement_FP64 (&tp, path_length, p)) ;
+        OK (GrB_Matrix_extractElement_FP64 (&apj, G->A, p, j)) ;
+        double err = fabs (tp + apj - tj) / LAGRAPH_MAX (1, fabs (tj)) ;
+        TEST_CHECK (err < 1e-5) ;
+        // following the parents from j reaches the source
+        int64_t k = 0 ;
+        for (int64_t i = j ; i != (int64_t) src && k <= (int64_t) n ; k++)
+        {
+            OK (GrB_Vector_extractElement_INT64 (&i, parent, i)) ;
+        }
+        TEST_CHECK (k <= (int64_t) n) ;
+    }
+    TEST_CHECK (nvals == nreach) ;
+}
+
 //****************************************************************************
 void test_SingleSourceShortestPath(void)
 {
@@ -296,6 +350,34 @@ void test_SingleSourceShortestPath_types (void)
                 OK (res) ;
                 OK (GrB_free(&path_length)) ;
             }
+
+            // automatic Delta, with fixed and adaptive bucket widths
+            for (int adaptive = 0 ; adaptive <= 1 ; adaptive++)
+            {
+                printf ("src %d automatic delta, adaptive: %d\n", (int) src,
+                    adaptive) ;
+                OK (LAGraph_SingleSourceShortestPath (&path_length, G, src,
+                    (bool) adaptive, msg)) ;
+                OK (LG_check_sssp (path_length, G, src, msg)) ;
+                OK (GrB_free(&path_length)) ;
+            }
+            TEST_CHECK (G->emax != NULL) ;
+            TEST_CHECK (G->out_degree != NULL) ;
+
+            // path lengths and the shortest path tree
+            GrB_Vector parent = NULL ;
+            OK (GrB_Scalar_setElement (Delta, 30)) ;
+            OK (LAGr_SingleSourceShortestPath_Parent (&path_length, &parent,
+                G, src, Delta, msg)) ;
+            OK (LG_check_sssp (path_length, G, src, msg)) ;
+            check_parent (path_length, parent, src) ;
+            OK (GrB_free (&path_length)) ;
+            OK (GrB_free (&parent)) ;
+
+            // parent only
+            OK (LAGr_SingleSourceShortestPath_Parent (NULL, &parent,
+                G, src, Delta, msg)) ;
+            OK (GrB_free (&parent)) ;
         }
 
         OK (LAGraph_Delete (&G, msg)) ;
@@ -305,6 +387,52 @@ void test_SingleSourceShortestPath_types (void)
     LAGraph_Finalize (msg) ;
 }
 
+//------------------------------------------------------------------------------
+// test_SingleSourceShortestPath_zero
+//------------------------------------------------------------------------------
+
+// The edges 1->2 and 2->1 form a zero-weight cycle, so the shortest path tree
+// is found with a BFS.
+
+void test_SingleSourceShortestPath_zero (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Scalar Delta = NULL ;
+    GrB_Vector path_length = NULL, parent = NULL ;
+    OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+    OK (GrB_Scalar_setElement (Delta, 2)) ;
+
+    GrB_Matrix A = NULL ;
+    GrB_Index I [5] = { 0, 1, 2, 2, 3 } ;
+    GrB_Index J [5] = { 1, 2, 1, 3, 4 } ;
+    int32_t   X [5] = { 1, 0, 0, 2, 3 } ;
+    OK (GrB_Matrix_new (&A, GrB_INT32, 6, 6)) ;
+    OK (GrB_Matrix_build (A, I, J, X, 5, GrB_PLUS_INT32)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (LAGraph_Cached_EMin (G, msg)) ;
+
+    OK (LAGr_SingleSourceShortestPath_Parent (&path_length, &parent, G, 0,
+        Delta, msg)) ;
+    OK (LG_check_sssp (path_length, G, 0, msg)) ;
+    check_parent (path_length, parent, 0) ;
+    int64_t p = -1 ;
+    OK (GrB_Vector_extractElement (&p, parent, 2)) ;
+    TEST_CHECK (p == 1) ;
+    OK (GrB_Vector_extractElement (&p, parent, 4)) ;
+    TEST_CHECK (p == 3) ;
+    OK (GrB_free (&path_length)) ;
+    OK (GrB_free (&parent)) ;
+
+    // both outputs NULL
+    int result = LAGr_SingleSourceShortestPath_Parent (NULL, NULL, G, 0,
+        Delta, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (GrB_free (&Delta)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
 //------------------------------------------------------------------------------
 // test_SingleSourceShortestPath_failure
 //------------------------------------------------------------------------------
@@ -335,6 +463,14 @@ void test_SingleSourceShortestPath_failure (void)
     TEST_CHECK (path_length == NULL) ;
     TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
 
+    result = LAGraph_SingleSourceShortestPath (&path_length, G, 0, true, msg) ;
+    printf ("\nres: %d msg: %s\n", result, msg) ;
+    TEST_CHECK (path_length == NULL) ;
+    TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
+
+    result = LAGraph_SingleSourceShortestPath (NULL, G, 0, true, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
     OK (GrB_Scalar_clear (Delta)) ;
     result = LAGr_SingleSourceShortestPath (&path_length, G, 0, Delta, msg) ;
     printf ("\nres: %d msg: %s\n", result, msg) ;
@@ -448,6 +584,7 @@ void test_SingleSourceShortestPath_brutal (void)
 TEST_LIST = {
     {"SSSP", test_SingleSourceShortestPath},
     {"SSSP_types", test_SingleSourceShortestPath_types},
+    {"SSSP_zero", test_SingleSourceShortestPath_zero},
     {"SSSP_failure", test_SingleSourceShortestPath_failure},
     #if LAGRAPH_SUITESPARSE
     {"SSSP_brutal", test_SingleSourceShortestPath_brutal },
@@ -257,6 +257,38 @@ void test_TriangleCount_Methods6(void)
     teardown();
 }
 
+//****************************************************************************
+void test_TriangleCount_Methods7(void)
+{
+    setup();
+    int retval;
+    uint64_t ntriangles = 0UL;
+
+    LAGr_TriangleCount_Presort presort = LAGr_TriangleCount_AutoSort ;
+    LAGr_TriangleCount_Method method = LAGr_TriangleCount_Intersect ;
+    ntriangles = 0UL;
+    // LAGr_TriangleCount_Intersect: same as Sandia_LUT
+    retval = LAGr_TriangleCount(&ntriangles, G, &method, &presort, msg);
+    // should fail (out_degrees needs to be defined)
+    TEST_CHECK(retval == LAGRAPH_NOT_CACHED);
+    TEST_MSG("retval = %d (%s)", retval, msg);
+
+    retval = LAGraph_Cached_OutDegree(G, msg);
+    TEST_CHECK(retval == 0);
+    TEST_MSG("retval = %d (%s)", retval, msg);
+
+    presort = LAGr_TriangleCount_AutoSort ;
+    method = LAGr_TriangleCount_Intersect ;
+    retval = LAGr_TriangleCount(&ntriangles, G, &method, &presort, msg);
+    TEST_CHECK(retval == 0);
+    TEST_MSG("retval = %d (%s)", retval, msg);
+
+    TEST_CHECK( ntriangles == 45 );
+    TEST_MSG("numtri = %g", (double) ntriangles) ;
+
+    teardown();
+}
+
 //****************************************************************************
 void test_TriangleCount(void)
 {
@@ -327,7 +359,7 @@ void test_TriangleCount_many (void)
         TEST_CHECK (nt0 == nt1) ;
 
         // try each method
-        for (int method = 0 ; method <= 6 ; method++)
+        for (int method = 0 ; method <= 7 ; method++)
         {
             for (int presort = 0 ; presort <= 2 ; presort++)
             {
@@ -354,6 +386,126 @@ void test_TriangleCount_many (void)
 
 //****************************************************************************
 
+// max (abs (x-y)) for two INT64 vectors
+static int64_t vector_difference (GrB_Vector x, GrB_Vector y)
+{
+    GrB_Vector d = NULL ;
+    GrB_Index n ;
+    OK (GrB_Vector_size (&n, x)) ;
+    OK (GrB_Vector_new (&d, GrB_INT64, n)) ;
+    OK (GrB_eWiseAdd (d, NULL, NULL, GrB_MINUS_INT64, x, y, NULL)) ;
+    OK (GrB_apply (d, NULL, NULL, GrB_ABS_INT64, d, NULL)) ;
+    int64_t err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_INT64, d, NULL)) ;
+    OK (GrB_free (&d)) ;
+    return (err) ;
+}
+
+// max (abs (X-Y)) for two INT64 matrices
+static int64_t matrix_difference (GrB_Matrix X, GrB_Matrix Y)
+{
+    GrB_Matrix D = NULL ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, X)) ;
+    OK (GrB_Matrix_new (&D, GrB_INT64, n, n)) ;
+    OK (GrB_eWiseAdd (D, NULL, NULL, GrB_MINUS_INT64, X, Y, NULL)) ;
+    OK (GrB_apply (D, NULL, NULL, GrB_ABS_INT64, D, NULL)) ;
+    int64_t err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_INT64, D, NULL)) ;
+    OK (GrB_free (&D)) ;
+    return (err) ;
+}
+
+void test_TriangleCount_local (void)
+{
+    LAGraph_Init(msg);
+    GrB_Matrix A = NULL, E = NULL, Eref = NULL ;
+    GrB_Vector t = NULL, tref = NULL ;
+    printf ("\n") ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the adjacency matrix as A
+        const char *aname = files [k].name ;
+        uint64_t ntriangles = files [k].ntriangles ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+
+        // create the graph
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        GrB_Index n, nvals, anvals ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        OK (GrB_Matrix_nvals (&anvals, G->A)) ;
+
+        // Eref<struct(A)> = A*A, and tref = sum (Eref,2) / 2
+        OK (GrB_Matrix_new (&Eref, GrB_INT64, n, n)) ;
+        OK (GrB_mxm (Eref, G->A, NULL, LAGraph_plus_one_int64, G->A, G->A,
+            GrB_DESC_S)) ;
+        OK (GrB_Vector_new (&tref, GrB_INT64, n)) ;
+        OK (GrB_assign (tref, NULL, NULL, (int64_t) 0, GrB_ALL, n, NULL)) ;
+        OK (GrB_reduce (tref, NULL, GrB_PLUS_INT64, GrB_PLUS_MONOID_INT64,
+            Eref, NULL)) ;
+        OK (GrB_apply (tref, NULL, NULL, GrB_DIV_INT64, tref, (int64_t) 2,
+            NULL)) ;
+
+        // try each method and presort
+        for (int method = 0 ; method <= 7 ; method++)
+        {
+            for (int presort = 0 ; presort <= 2 ; presort++)
+            {
+                LAGr_TriangleCount_Presort s = presort ;
+                LAGr_TriangleCount_Method m = method ;
+                OK (LAGr_TriangleCountLocal (&t, &E, G, &m, &s, msg)) ;
+
+                // check the per-node counts
+                int64_t tsum = 0 ;
+                TEST_CHECK (vector_difference (t, tref) == 0) ;
+                OK (GrB_Vector_nvals (&nvals, t)) ;
+                TEST_CHECK (nvals == n) ;
+                OK (GrB_reduce (&tsum, NULL, GrB_PLUS_MONOID_INT64, t, NULL)) ;
+                TEST_CHECK ((uint64_t) tsum == 3 * ntriangles) ;
+
+                // check the per-edge counts
+                TEST_CHECK (matrix_difference (E, Eref) == 0) ;
+                OK (GrB_Matrix_nvals (&nvals, E)) ;
+                TEST_CHECK (nvals == anvals) ;
+
+                OK (GrB_free (&t)) ;
+                OK (GrB_free (&E)) ;
+
+                // per-node counts only
+                OK (LAGr_TriangleCountLocal (&t, NULL, G, &m, &s, msg)) ;
+                TEST_CHECK (vector_difference (t, tref) == 0) ;
+                OK (GrB_free (&t)) ;
+            }
+        }
+
+        // invalid method
+        LAGr_TriangleCount_Method method = 99 ;
+        int result = LAGr_TriangleCountLocal (&t, &E, G, &method, NULL, msg) ;
+        TEST_CHECK (result == GrB_INVALID_VALUE) ;
+        TEST_CHECK (t == NULL && E == NULL) ;
+        result = LAGr_TriangleCountLocal (NULL, &E, G, NULL, NULL, msg) ;
+        TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+        OK (GrB_free (&Eref)) ;
+        OK (GrB_free (&tref)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize(msg);
+}
+
+//****************************************************************************
+
 void test_TriangleCount_autosort (void)
 {
     OK (LAGraph_Init(msg)) ;
@@ -383,7 +535,7 @@ void test_TriangleCount_autosort (void)
 
     // try each method; with autosort
     GrB_Index nt1 = 0 ;
-    for (int method = 0 ; method <= 6 ; method++)
+    for (int method = 0 ; method <= 7 ; method++)
     {
         LAGr_TriangleCount_Presort presort = LAGr_TriangleCount_AutoSort ;
         LAGr_TriangleCount_Method m = method ;
@@ -399,6 +551,138 @@ void test_TriangleCount_autosort (void)
     OK (LAGraph_Finalize(msg)) ;
 }
 
+//****************************************************************************
+
+void test_TriangleCount_calibrate (void)
+{
+    OK (LAGraph_Init(msg)) ;
+    GrB_Matrix A = NULL ;
+    printf ("\n") ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the adjacency matrix as A
+        const char *aname = files [k].name ;
+        uint64_t ntriangles = files [k].ntriangles ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+
+        // create the graph
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+        TEST_CHECK (G->tc_method == LAGRAPH_UNKNOWN) ;
+
+        for (int trial = 0 ; trial <= 1 ; trial++)
+        {
+            // calibrate with the default sample size, and with 10 nodes
+            OK (LAGraph_TriangleCount_Calibrate (G, (trial == 0) ? 0 : 10,
+                42, msg)) ;
+            printf ("%s: method %d presort %d\n", aname, G->tc_method,
+                G->tc_presort) ;
+            TEST_CHECK (G->tc_method >= LAGr_TriangleCount_Sandia_LL &&
+                        G->tc_method <= LAGr_TriangleCount_Intersect) ;
+            TEST_CHECK (G->tc_presort == LAGr_TriangleCount_NoSort ||
+                        G->tc_presort == LAGr_TriangleCount_Ascending ||
+                        G->tc_presort == LAGr_TriangleCount_Descending) ;
+            TEST_CHECK (G->out_degree != NULL) ;
+
+            // the calibrated method and presort are used by default
+            LAGr_TriangleCount_Method m = LAGr_TriangleCount_AutoMethod ;
+            LAGr_TriangleCount_Presort s = LAGr_TriangleCount_AutoSort ;
+            uint64_t nt1 = 0 ;
+            OK (LAGr_TriangleCount (&nt1, G, &m, &s, msg)) ;
+            TEST_CHECK (nt1 == ntriangles) ;
+            TEST_CHECK (m == G->tc_method) ;
+            TEST_CHECK (s == G->tc_presort) ;
+            nt1 = 0 ;
+            OK (LAGraph_TriangleCount (&nt1, G, msg)) ;
+            TEST_CHECK (nt1 == ntriangles) ;
+
+            // calibrating again does nothing
+            int method = G->tc_method, presort = G->tc_presort ;
+            OK (LAGraph_TriangleCount_Calibrate (G, 0, 99, msg)) ;
+            TEST_CHECK (G->tc_method == method) ;
+            TEST_CHECK (G->tc_presort == presort) ;
+
+            // any other method still works with the AutoSort
+            for (int method2 = 1 ; method2 <= 7 ; method2++)
+            {
+                m = method2 ;
+                s = LAGr_TriangleCount_AutoSort ;
+                nt1 = 0 ;
+                OK (LAGr_TriangleCount (&nt1, G, &m, &s, msg)) ;
+                TEST_CHECK (nt1 == ntriangles) ;
+            }
+
+            // an invalid calibration is ignored
+            G->tc_method = 99 ;
+            m = LAGr_TriangleCount_AutoMethod ;
+            s = LAGr_TriangleCount_AutoSort ;
+            nt1 = 0 ;
+            OK (LAGr_TriangleCount (&nt1, G, &m, &s, msg)) ;
+            TEST_CHECK (nt1 == ntriangles) ;
+            TEST_CHECK (m == LAGr_TriangleCount_Sandia_LUT) ;
+            G->tc_method = method ;
+            G->tc_presort = 7 ;
+            m = LAGr_TriangleCount_AutoMethod ;
+            s = LAGr_TriangleCount_AutoSort ;
+            nt1 = 0 ;
+            OK (LAGr_TriangleCount (&nt1, G, &m, &s, msg)) ;
+            TEST_CHECK (nt1 == ntriangles) ;
+            TEST_CHECK (m == LAGr_TriangleCount_Sandia_LUT) ;
+            G->tc_presort = presort ;
+
+            // the calibration is cleared with the other cached properties
+            OK (LAGraph_DeleteCached (G, msg)) ;
+            TEST_CHECK (G->tc_method == LAGRAPH_UNKNOWN) ;
+            TEST_CHECK (G->tc_presort == LAGr_TriangleCount_AutoSort) ;
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    int result = LAGraph_TriangleCount_Calibrate (NULL, 0, 0, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G must be symmetric
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    result = LAGraph_TriangleCount_Calibrate (G, 0, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED) ;
+    TEST_CHECK (G->tc_method == LAGRAPH_UNKNOWN) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // G must not have self-edges
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "bcsstk13.mtx") ;
+    f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    result = LAGraph_TriangleCount_Calibrate (G, 0, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NO_SELF_EDGES_ALLOWED) ;
+    TEST_CHECK (G->tc_method == LAGRAPH_UNKNOWN) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    OK (LAGraph_Finalize(msg)) ;
+}
+
 //------------------------------------------------------------------------------
 // test_TriangleCount_brutal
 //------------------------------------------------------------------------------
@@ -452,7 +736,7 @@ void test_TriangleCount_brutal (void)
         TEST_CHECK (nt0 == nt1) ;
 
         // try each method
-        for (int method = 0 ; method <= 6 ; method++)
+        for (int method = 0 ; method <= 7 ; method++)
         {
             for (int presort = 0 ; presort <= 2 ; presort++)
             {
@@ -480,9 +764,12 @@ TEST_LIST = {
     {"TriangleCount_Methods4", test_TriangleCount_Methods4},
     {"TriangleCount_Methods5", test_TriangleCount_Methods5},
     {"TriangleCount_Methods6", test_TriangleCount_Methods6},
+    {"TriangleCount_Methods7", test_TriangleCount_Methods7},
     {"TriangleCount"         , test_TriangleCount},
     {"TriangleCount_many"    , test_TriangleCount_many},
+    {"TriangleCount_local"   , test_TriangleCount_local},
     {"TriangleCount_autosort", test_TriangleCount_autosort},
+    {"TriangleCount_calibrate", test_TriangleCount_calibrate},
     #if LAGRAPH_SUITESPARSE
     {"TriangleCount_brutal"  , test_TriangleCount_brutal},
     #endif
@@ -0,0 +1,343 @@
+//----------------------------------------------------------------------------
+// LAGraph/src/test/test_TriangleList.c: test cases for triangle listing
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    uint64_t ntriangles ;           // # triangles in original matrix
+    const char *name ;              // matrix filename
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    {     45, "karate.mtx" },
+    {     11, "A.mtx" },
+    {   2016, "jagmesh7.mtx" },
+    {      6, "ldbc-cdlp-undirected-example.mtx" },
+    {      4, "ldbc-undirected-example.mtx" },
+    {      5, "ldbc-wcc-example.mtx" },
+    {      0, "LFAT5.mtx" },
+    { 342300, "bcsstk13.mtx" },
+    {      0, "tree-example.mtx" },
+    {      0, "" },
+} ;
+
+//****************************************************************************
+// collect: a callback that collects all the triangles
+//****************************************************************************
+
+typedef struct
+{
+    GrB_Index *I, *J, *K ;      // the triangles listed so far
+    int64_t ntri ;              // # of triangles listed so far
+    int64_t nmax ;              // size of I, J, and K
+    int64_t nchunks ;           // # of calls to collect
+    int64_t chunk_size ;        // size of each chunk
+    bool ok ;                   // true if all chunks are valid
+    int result ;                // value to return after the first chunk
+}
+triangle_list ;
+
+static int collect
+(
+    const GrB_Index *I,
+    const GrB_Index *J,
+    const GrB_Index *K,
+    int64_t ntri,
+    void *user_data
+)
+{
+    triangle_list *list = (triangle_list *) user_data ;
+    // each chunk is full, except possibly the last one
+    if (ntri <= 0 || ntri > list->chunk_size ||
+        list->ntri + ntri > list->nmax)
+    {
+        list->ok = false ;
+        return (-1) ;
+    }
+    for (int64_t t = 0 ; t < ntri ; t++)
+    {
+        list->ok = list->ok && (I [t] > J [t] && J [t] > K [t]) ;
+        list->I [list->ntri] = I [t] ;
+        list->J [list->ntri] = J [t] ;
+        list->K [list->ntri] = K [t] ;
+        list->ntri++ ;
+    }
+    list->nchunks++ ;
+    return (list->result) ;
+}
+
+//****************************************************************************
+
+void test_TriangleList (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix T = NULL, Eref = NULL, D = NULL ;
+    GrB_Index *I = NULL, *J = NULL, *K = NULL, *Ti = NULL, *Tj = NULL ;
+    int64_t *Tx = NULL ;
+    triangle_list list, list1 ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the graph
+        const char *aname = files [k].name ;
+        int64_t ntriangles = (int64_t) files [k].ntriangles ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\n================================== %d %s:\n", k, aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        fclose (f) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        // Eref<struct(A)> = A*A, the # of triangles on each edge
+        OK (GrB_Matrix_new (&Eref, GrB_INT64, n, n)) ;
+        OK (GrB_mxm (Eref, G->A, NULL, LAGraph_plus_one_int64, G->A, G->A,
+            GrB_DESC_S)) ;
+
+        int64_t nmax = LAGRAPH_MAX (ntriangles, 1) ;
+        list1.nmax = nmax ;
+        OK (LAGraph_Malloc ((void **) &(list1.I), nmax, sizeof (GrB_Index),
+            msg)) ;
+        OK (LAGraph_Malloc ((void **) &(list1.J), nmax, sizeof (GrB_Index),
+            msg)) ;
+        OK (LAGraph_Malloc ((void **) &(list1.K), nmax, sizeof (GrB_Index),
+            msg)) ;
+        list.nmax = nmax ;
+        OK (LAGraph_Malloc ((void **) &(list.I), nmax, sizeof (GrB_Index),
+            msg)) ;
+        OK (LAGraph_Malloc ((void **) &(list.J), nmax, sizeof (GrB_Index),
+            msg)) ;
+        OK (LAGraph_Malloc ((void **) &(list.K), nmax, sizeof (GrB_Index),
+            msg)) ;
+
+        int64_t chunk_sizes [4] = { 1000000, 1, 7, 1000 } ;
+        for (int kk = 0 ; kk < 4 ; kk++)
+        {
+
+            //------------------------------------------------------------------
+            // list all the triangles
+            //------------------------------------------------------------------
+
+            int64_t chunk_size = chunk_sizes [kk] ;
+            OK (LAGraph_Malloc ((void **) &I, chunk_size, sizeof (GrB_Index),
+                msg)) ;
+            OK (LAGraph_Malloc ((void **) &J, chunk_size, sizeof (GrB_Index),
+                msg)) ;
+            OK (LAGraph_Malloc ((void **) &K, chunk_size, sizeof (GrB_Index),
+                msg)) ;
+            triangle_list *lst = (kk == 0) ? &list1 : &list ;
+            lst->ntri = 0 ;
+            lst->nchunks = 0 ;
+            lst->chunk_size = chunk_size ;
+            lst->ok = true ;
+            lst->result = 0 ;
+            uint64_t nlisted = 0 ;
+            OK (LAGr_TriangleList (&nlisted, I, J, K, chunk_size, collect, lst,
+                G, msg)) ;
+            printf ("chunk_size %g: %g triangles in %g chunks\n",
+                (double) chunk_size, (double) lst->ntri,
+                (double) lst->nchunks) ;
+            TEST_CHECK (lst->ok) ;
+            TEST_CHECK (lst->ntri == ntriangles) ;
+            TEST_CHECK (nlisted == (uint64_t) ntriangles) ;
+            TEST_CHECK (lst->nchunks ==
+                (ntriangles + chunk_size - 1) / chunk_size) ;
+
+            if (kk == 0)
+            {
+
+                //--------------------------------------------------------------
+                // check the triangles against the per-edge counts
+                //--------------------------------------------------------------
+
+                // T = # of listed triangles on each edge, which must be the
+                // same as Eref
+                int64_t nt = 6 * ntriangles ;
+                OK (LAGraph_Malloc ((void **) &Ti, LAGRAPH_MAX (nt, 1),
+                    sizeof (GrB_Index), msg)) ;
+                OK (LAGraph_Malloc ((void **) &Tj, LAGRAPH_MAX (nt, 1),
+                    sizeof (GrB_Index), msg)) ;
+                OK (LAGraph_Malloc ((void **) &Tx, LAGRAPH_MAX (nt, 1),
+                    sizeof (int64_t), msg)) ;
+                for (int64_t t = 0 ; t < ntriangles ; t++)
+                {
+                    GrB_Index ti = lst->I [t], tj = lst->J [t] ;
+                    GrB_Index tk = lst->K [t] ;
+                    GrB_Index *Ti6 = Ti + 6*t, *Tj6 = Tj + 6*t ;
+                    Ti6 [0] = ti ; Tj6 [0] = tj ;
+                    Ti6 [1] = tj ; Tj6 [1] = ti ;
+                    Ti6 [2] = tj ; Tj6 [2] = tk ;
+                    Ti6 [3] = tk ; Tj6 [3] = tj ;
+                    Ti6 [4] = ti ; Tj6 [4] = tk ;
+                    Ti6 [5] = tk ; Tj6 [5] = ti ;
+                    for (int s = 0 ; s < 6 ; s++) Tx [6*t+s] = 1 ;
+                }
+                OK (GrB_Matrix_new (&T, GrB_INT64, n, n)) ;
+                OK (GrB_Matrix_build (T, Ti, Tj, Tx, nt, GrB_PLUS_INT64)) ;
+                OK (GrB_Matrix_new (&D, GrB_INT64, n, n)) ;
+                OK (GrB_eWiseAdd (D, NULL, NULL, GrB_MINUS_INT64, T, Eref,
+                    NULL)) ;
+                OK (GrB_apply (D, NULL, NULL, GrB_ABS_INT64, D, NULL)) ;
+                int64_t err = 0 ;
+                OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_INT64, D, NULL)) ;
+                TEST_CHECK (err == 0) ;
+                OK (GrB_free (&T)) ;
+                OK (GrB_free (&D)) ;
+                OK (LAGraph_Free ((void **) &Ti, msg)) ;
+                OK (LAGraph_Free ((void **) &Tj, msg)) ;
+                OK (LAGraph_Free ((void **) &Tx, msg)) ;
+            }
+            else
+            {
+                // the triangles are listed in the same order for any
+                // chunk_size
+                bool same = true ;
+                for (int64_t t = 0 ; t < ntriangles ; t++)
+                {
+                    same = same && (list.I [t] == list1.I [t])
+                                && (list.J [t] == list1.J [t])
+                                && (list.K [t] == list1.K [t]) ;
+                }
+                TEST_CHECK (same) ;
+            }
+
+            //------------------------------------------------------------------
+            // stop the listing after the first chunk
+            //------------------------------------------------------------------
+
+            if (ntriangles > 0)
+            {
+                list.ntri = 0 ;
+                list.nchunks = 0 ;
+                list.chunk_size = chunk_size ;
+                list.ok = true ;
+                list.result = 1 ;
+                OK (LAGr_TriangleList (&nlisted, I, J, K, chunk_size,
+                    collect, &list, G, msg)) ;
+                TEST_CHECK (list.ok) ;
+                TEST_CHECK (list.nchunks == 1) ;
+                TEST_CHECK (nlisted ==
+                    (uint64_t) LAGRAPH_MIN (chunk_size, ntriangles)) ;
+            }
+
+            OK (LAGraph_Free ((void **) &I, msg)) ;
+            OK (LAGraph_Free ((void **) &J, msg)) ;
+            OK (LAGraph_Free ((void **) &K, msg)) ;
+        }
+
+        OK (LAGraph_Free ((void **) &(list1.I), msg)) ;
+        OK (LAGraph_Free ((void **) &(list1.J), msg)) ;
+        OK (LAGraph_Free ((void **) &(list1.K), msg)) ;
+        OK (LAGraph_Free ((void **) &(list.I), msg)) ;
+        OK (LAGraph_Free ((void **) &(list.J), msg)) ;
+        OK (LAGraph_Free ((void **) &(list.K), msg)) ;
+        OK (GrB_free (&Eref)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//****************************************************************************
+
+void test_TriangleList_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Index I [16], J [16], K [16] ;
+    uint64_t nlisted = 0 ;
+    triangle_list list ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    // G must be symmetric
+    int result = LAGr_TriangleList (&nlisted, I, J, K, 16, collect, &list,
+        G, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    fclose (f) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    // invalid chunk_size
+    result = LAGr_TriangleList (&nlisted, I, J, K, 0, collect, &list, G, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // NULL buffers or callback
+    result = LAGr_TriangleList (&nlisted, NULL, J, K, 16, collect, &list, G,
+        msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGr_TriangleList (&nlisted, I, J, K, 16, NULL, &list, G, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // the callback function fails on the second chunk, since the list is
+    // too short
+    GrB_Index LI [16], LJ [16], LK [16] ;
+    list.I = LI ;
+    list.J = LJ ;
+    list.K = LK ;
+    list.nmax = 16 ;
+    list.ntri = 0 ;
+    list.nchunks = 0 ;
+    list.chunk_size = 16 ;
+    list.ok = true ;
+    list.result = 0 ;
+    result = LAGr_TriangleList (&nlisted, I, J, K, 16, collect, &list, G, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == -1) ;
+    TEST_CHECK (list.nchunks == 1) ;
+    TEST_CHECK (nlisted == 16) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"TriangleList", test_TriangleList},
+    {"TriangleList_errors", test_TriangleList_errors},
+    {NULL, NULL}
+};
@@ -57,5 +57,10 @@ int LAGraph_DeleteCached
     G->emin_state = LAGRAPH_UNKNOWN ;
     G->emax_state = LAGRAPH_UNKNOWN ;
     G->nself_edges = LAGRAPH_UNKNOWN ;
+    G->bfs_alpha = LAGRAPH_UNKNOWN ;
+    G->bfs_beta1 = LAGRAPH_UNKNOWN ;
+    G->bfs_beta2 = LAGRAPH_UNKNOWN ;
+    G->tc_method = LAGRAPH_UNKNOWN ;
+    G->tc_presort = LAGr_TriangleCount_AutoSort ;
     return (GrB_SUCCESS) ;
 }
@@ -71,6 +71,16 @@ int LAGraph_Graph_Print
         FPRINTF (f, "  self-edges: %g", (double) G->nself_edges) ;
     }
     FPRINTF (f, "\n") ;
+    if (G->bfs_alpha > 0 && G->bfs_beta1 > 0 && G->bfs_beta2 > 0)
+    {
+        FPRINTF (f, "  BFS thresholds: alpha: %g beta1: %g beta2: %g\n",
+            G->bfs_alpha, G->bfs_beta1, G->bfs_beta2) ;
+    }
+    if (G->tc_method > 0)
+    {
+        FPRINTF (f, "  triangle count: method: %d presort: %d\n",
+            G->tc_method, G->tc_presort) ;
+    }
 
     FPRINTF (f, "  adjacency matrix: ") ;
 
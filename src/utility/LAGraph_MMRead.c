@@ -30,11 +30,13 @@
 //  GrB_NOT_IMPLEMENTED: complex types not yet supported
 //  other: return values directly from GrB_* methods
 
-#define LG_FREE_WORK                    \
-{                                       \
-    LAGraph_Free ((void **) &I, NULL) ; \
-    LAGraph_Free ((void **) &J, NULL) ; \
-    LAGraph_Free ((void **) &X, NULL) ; \
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &I, NULL) ;         \
+    LAGraph_Free ((void **) &J, NULL) ;         \
+    LAGraph_Free ((void **) &X, NULL) ;         \
+    LAGraph_Free ((void **) &Block, NULL) ;     \
+    LAGraph_Free ((void **) &Work, NULL) ;      \
 }
 
 #define LG_FREE_ALL                     \
@@ -177,7 +179,7 @@ static inline bool read_entry   // returns true if successful, false if failure
 {
 
     int64_t ival = 1 ;
-    double rval = 1, zval = 0 ;
+    double rval = 1 ;
 
     while (*p && isspace (*p)) p++ ;   // skip any spaces
 
@@ -286,6 +288,7 @@ static inline bool read_entry   // returns true if successful, false if failure
 #if 0
     else if (type == GxB_FC32)
     {
+        double zval = 0 ;
         if (!structural && !read_double (p, &rval)) return (false) ;
         while (*p && !isspace (*p)) p++ ;   // skip real part
         if (!structural && !read_double (p, &zval)) return (false) ;
@@ -295,6 +298,7 @@ static inline bool read_entry   // returns true if successful, false if failure
     }
     else if (type == GxB_FC64)
     {
+        double zval = 0 ;
         if (!structural && !read_double (p, &rval)) return (false) ;
         while (*p && !isspace (*p)) p++ ;   // skip real part
         if (!structural && !read_double (p, &zval)) return (false) ;
@@ -390,15 +394,455 @@ static inline void set_value
 }
 
 //------------------------------------------------------------------------------
-// LAGraph_MMRead
+// block-mode parsing: tokenizers for the triplets of a coordinate file
 //------------------------------------------------------------------------------
 
-int LAGraph_MMRead
+// LAGr_MMRead with blocksize > 0 reads the triplets of a coordinate file in
+// large blocks with fread, instead of one line at a time with fgets.  Each
+// block is split at line boundaries into chunks that are parsed in parallel.
+// The tokenizers below replace sscanf, but they accept exactly the same input
+// as the line-by-line reader: if a value cannot be parsed by the fast path,
+// it falls back to read_double or read_entry on a copy of the token.
+
+// LG_MM_CHUNK: minimum number of bytes parsed by a single task
+#define LG_MM_CHUNK (16*1024)
+
+// powers of 10 that are exactly representable as a double
+static const double mm_pow10 [23] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+} ;
+
+// true if c is a space character, but not the end of the line
+#define MM_SPACE(c) ((c) != '\n' && isspace ((unsigned char) (c)))
+
+//------------------------------------------------------------------------------
+// mm_is_blank: true if the line p [0..len-1] is blank or a comment
+//------------------------------------------------------------------------------
+
+// Same as is_blank_line: a comment line has a '%' in the first column.
+
+static inline bool mm_is_blank
+(
+    const char *p,      // line to check, not null-terminated
+    size_t len          // length of the line, excluding the newline
+)
+{
+    if (len > 0 && p [0] == '%') return (true) ;
+    for (size_t k = 0 ; k < len ; k++)
+    {
+        if (!isspace ((unsigned char) p [k])) return (false) ;
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// mm_parse_uint64: parse an unsigned integer, as sscanf ("%" SCNu64)
+//------------------------------------------------------------------------------
+
+// Leading spaces and an optional sign are skipped.  A negative value wraps
+// around, and overflow saturates to UINT64_MAX, just like strtoull.
+
+static inline bool mm_parse_uint64  // true if successful, false if failure
+(
+    const char **p_handle,  // on input: start of token; on output: just past it
+    const char *pend,       // end of the line
+    uint64_t *result
+)
+{
+    const char *p = (*p_handle) ;
+    while (p < pend && MM_SPACE (*p)) p++ ;
+    bool negative = false ;
+    if (p < pend && (*p == '+' || *p == '-'))
+    {
+        negative = (*p == '-') ;
+        p++ ;
+    }
+    if (p >= pend || !isdigit ((unsigned char) *p)) return (false) ;
+    uint64_t x = 0 ;
+    bool overflow = false ;
+    for ( ; p < pend && isdigit ((unsigned char) *p) ; p++)
+    {
+        uint64_t d = (uint64_t) (*p - '0') ;
+        if (x > (UINT64_MAX - d) / 10) overflow = true ;
+        x = 10 * x + d ;
+    }
+    if (overflow)
+    {
+        x = UINT64_MAX ;
+    }
+    else if (negative)
+    {
+        x = (uint64_t) (- x) ;
+    }
+    (*result) = x ;
+    (*p_handle) = p ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// mm_parse_int64: parse a signed integer, as sscanf ("%" SCNd64)
+//------------------------------------------------------------------------------
+
+// Overflow saturates to INT64_MIN or INT64_MAX, just like strtoll.
+
+static inline bool mm_parse_int64   // true if successful, false if failure
+(
+    const char *p,          // start of the token
+    const char *pend,       // end of the line
+    int64_t *result
+)
+{
+    while (p < pend && MM_SPACE (*p)) p++ ;
+    bool negative = false ;
+    if (p < pend && (*p == '+' || *p == '-'))
+    {
+        negative = (*p == '-') ;
+        p++ ;
+    }
+    if (p >= pend || !isdigit ((unsigned char) *p)) return (false) ;
+    uint64_t x = 0 ;
+    uint64_t xmax = negative ? ((uint64_t) INT64_MAX) + 1 : INT64_MAX ;
+    bool overflow = false ;
+    for ( ; p < pend && isdigit ((unsigned char) *p) ; p++)
+    {
+        uint64_t d = (uint64_t) (*p - '0') ;
+        if (overflow || x > (xmax - d) / 10)
+        {
+            overflow = true ;
+        }
+        else
+        {
+            x = 10 * x + d ;
+        }
+    }
+    if (overflow) x = xmax ;
+    (*result) = negative ? ((x == xmax) ? INT64_MIN : - ((int64_t) x))
+                         : (int64_t) x ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// mm_parse_double: parse a floating-point value, as read_double
+//------------------------------------------------------------------------------
+
+// Values of the form [+-]digits[.digits][(e|E)[+-]digits] with at most 19
+// significant digits, a mantissa that is exactly representable, and a
+// decimal exponent of at most 22 in magnitude are computed with a single
+// multiply or divide, which is correctly rounded and thus identical to the
+// result from sscanf.  All other values (inf, nan, hex, long mantissas, huge
+// exponents, ...) are parsed by read_double on a copy of the token.
+
+static inline bool mm_parse_double  // true if successful, false if failure
+(
+    const char *p,          // start of the token
+    const char *pend,       // end of the line
+    double *result
+)
+{
+    while (p < pend && MM_SPACE (*p)) p++ ;
+    const char *pstart = p ;
+
+    // optional sign
+    bool negative = false ;
+    if (p < pend && (*p == '+' || *p == '-'))
+    {
+        negative = (*p == '-') ;
+        p++ ;
+    }
+
+    // mantissa
+    uint64_t m = 0 ;
+    int ndigits = 0, nsig = 0, exp10 = 0 ;
+    for ( ; p < pend && isdigit ((unsigned char) *p) ; p++, ndigits++)
+    {
+        if (m == 0 && *p == '0') continue ;     // skip leading zeros
+        if (nsig++ < 19) m = 10 * m + (uint64_t) (*p - '0') ;
+    }
+    if (p < pend && *p == '.')
+    {
+        for (p++ ; p < pend && isdigit ((unsigned char) *p) ; p++, ndigits++)
+        {
+            if (m == 0 && *p == '0') { exp10-- ; continue ; }
+            if (nsig++ < 19)
+            {
+                m = 10 * m + (uint64_t) (*p - '0') ;
+                exp10-- ;
+            }
+        }
+    }
+
+    // exponent
+    bool fast = (ndigits > 0 && nsig <= 19) ;
+    if (fast && p < pend && (*p == 'e' || *p == 'E'))
+    {
+        const char *q = p + 1 ;
+        bool eneg = false ;
+        if (q < pend && (*q == '+' || *q == '-'))
+        {
+            eneg = (*q == '-') ;
+            q++ ;
+        }
+        if (q < pend && isdigit ((unsigned char) *q))
+        {
+            int e = 0 ;
+            for ( ; q < pend && isdigit ((unsigned char) *q) ; q++)
+            {
+                if (e < 10000) e = 10 * e + (*q - '0') ;
+            }
+            exp10 += eneg ? (-e) : e ;
+            p = q ;
+        }
+    }
+
+    // the token must end here, and the result must be exact
+    fast = fast && (p == pend || MM_SPACE (*p))
+        && (m <= (((uint64_t) 1) << 53)) && (exp10 >= -22 && exp10 <= 22) ;
+
+    if (fast)
+    {
+        double x = (double) m ;
+        x = (exp10 < 0) ? (x / mm_pow10 [-exp10]) : (x * mm_pow10 [exp10]) ;
+        (*result) = negative ? (-x) : x ;
+        return (true) ;
+    }
+
+    // slow path: copy the token and use read_double
+    char token [MAXLINE+1] ;
+    size_t len = LAGRAPH_MIN ((size_t) (pend - pstart), (size_t) MAXLINE) ;
+    for (size_t k = 0 ; k < len ; k++)
+    {
+        token [k] = tolower ((unsigned char) pstart [k]) ;
+    }
+    token [len] = '\0' ;
+    return (read_double (token, result)) ;
+}
+
+//------------------------------------------------------------------------------
+// mm_parse_entry: parse a numerical value, as read_entry
+//------------------------------------------------------------------------------
+
+static inline bool mm_parse_entry   // true if successful, false if failure
+(
+    const char *p,      // start of the value
+    const char *pend,   // end of the line
+    GrB_Type type,      // type of value to read
+    bool structural,    // if true, then the value is 1
+    uint8_t *x          // value read in, of size at least the size of the type
+)
+{
+    int64_t ival = 1 ;
+    double rval = 1 ;
+
+    // mm_parse_double and mm_parse_int64 skip any leading spaces
+
+    if (type == GrB_FP64)
+    {
+        if (!structural && !mm_parse_double (p, pend, &rval)) return (false) ;
+        double *result = (double *) x ;
+        result [0] = rval ;
+    }
+    else if (type == GrB_FP32)
+    {
+        if (!structural && !mm_parse_double (p, pend, &rval)) return (false) ;
+        float *result = (float *) x ;
+        result [0] = (float) rval ;
+    }
+    else if (type == GrB_UINT64)
+    {
+        uint64_t uval = 1 ;
+        if (!structural && !mm_parse_uint64 (&p, pend, &uval)) return (false) ;
+        uint64_t *result = (uint64_t *) x ;
+        result [0] = uval ;
+    }
+    else
+    {
+        // bool, int8, int16, int32, int64, uint8, uint16, or uint32: parse
+        // the value as an int64_t, then check its range and typecast it
+        if (!structural && !mm_parse_int64 (p, pend, &ival)) return (false) ;
+        if (type == GrB_INT64)
+        {
+            int64_t *result = (int64_t *) x ;
+            result [0] = ival ;
+        }
+        else if (type == GrB_BOOL)
+        {
+            if (ival < 0 || ival > 1) return (false) ;
+            bool *result = (bool *) x ;
+            result [0] = (bool) ival ;
+        }
+        else if (type == GrB_INT8)
+        {
+            if (ival < INT8_MIN || ival > INT8_MAX) return (false) ;
+            int8_t *result = (int8_t *) x ;
+            result [0] = (int8_t) ival ;
+        }
+        else if (type == GrB_INT16)
+        {
+            if (ival < INT16_MIN || ival > INT16_MAX) return (false) ;
+            int16_t *result = (int16_t *) x ;
+            result [0] = (int16_t) ival ;
+        }
+        else if (type == GrB_INT32)
+        {
+            if (ival < INT32_MIN || ival > INT32_MAX) return (false) ;
+            int32_t *result = (int32_t *) x ;
+            result [0] = (int32_t) ival ;
+        }
+        else if (type == GrB_UINT8)
+        {
+            if (ival < 0 || ival > UINT8_MAX) return (false) ;
+            uint8_t *result = (uint8_t *) x ;
+            result [0] = (uint8_t) ival ;
+        }
+        else if (type == GrB_UINT16)
+        {
+            if (ival < 0 || ival > UINT16_MAX) return (false) ;
+            uint16_t *result = (uint16_t *) x ;
+            result [0] = (uint16_t) ival ;
+        }
+        else if (type == GrB_UINT32)
+        {
+            if (ival < 0 || ival > UINT32_MAX) return (false) ;
+            uint32_t *result = (uint32_t *) x ;
+            result [0] = (uint32_t) ival ;
+        }
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// mm_count_chunk: count the lines and entries in a chunk
+//------------------------------------------------------------------------------
+
+static void mm_count_chunk
+(
+    const char *p,          // start of the chunk (at the start of a line)
+    const char *pend,       // end of the chunk (just past a newline, or EOF)
+    int64_t *nlines,        // # of lines in the chunk
+    int64_t *nentries       // # of lines that hold an entry
+)
+{
+    int64_t nl = 0, ne = 0 ;
+    while (p < pend)
+    {
+        const char *eol = memchr (p, '\n', pend - p) ;
+        if (eol == NULL) eol = pend ;
+        nl++ ;
+        if (!mm_is_blank (p, eol - p)) ne++ ;
+        p = eol + 1 ;
+    }
+    (*nlines) = nl ;
+    (*nentries) = ne ;
+}
+
+//------------------------------------------------------------------------------
+// mm_parse_chunk: parse the entries in a chunk
+//------------------------------------------------------------------------------
+
+// Parses the entries in p [0..pend-1] and places the kth entry of the file in
+// I [k], J [k], and X [k*typesize], for all k < nvals.  Entries past the first
+// nvals are ignored, just as the line-by-line reader never reads them.  Only
+// the entry itself is saved; the mirror entries of a symmetric or
+// skew-symmetric matrix are added after the whole file has been read.
+
+typedef enum
+{
+    MM_entry_ok = 0,        // all entries in the chunk are valid
+    MM_bad_indices = 1,     // row and column indices cannot be parsed
+    MM_bad_row = 2,         // row index out of range
+    MM_bad_col = 3,         // column index out of range
+    MM_bad_value = 4,       // value cannot be parsed, or is out of range
+    MM_line_too_long = 5    // line does not fit in MAXLINE characters
+}
+MM_entry_status ;
+
+static MM_entry_status mm_parse_chunk
+(
+    const char *p,          // start of the chunk (at the start of a line)
+    const char *pend,       // end of the chunk (just past a newline, or EOF)
+    int64_t line,           // line number of the first line in the chunk
+    GrB_Index k,            // index of the first entry in the chunk
+    GrB_Index nvals,        // # of entries to read from the file
+    GrB_Index nrows,
+    GrB_Index ncols,
+    GrB_Type type,
+    size_t typesize,
+    bool structural,        // if true, all values are 1
+    GrB_Index *I,
+    GrB_Index *J,
+    uint8_t *X,
+    int64_t *err_line,      // line number of the first error, if any
+    GrB_Index *err_index    // the index that is out of range, if any
+)
+{
+    for ( ; p < pend && k < nvals ; line++)
+    {
+        const char *eol = memchr (p, '\n', pend - p) ;
+        if (eol == NULL) eol = pend ;
+        const char *s = p ;
+        p = eol + 1 ;
+
+        // skip blank lines and comments, of any length
+        (*err_line) = line ;
+        if (mm_is_blank (s, eol - s)) continue ;
+
+        // the line-by-line reader would split this line with fgets if its
+        // significant part does not fit in MAXLINE-1 characters; any trailing
+        // spaces would be split off as a blank line, and skipped
+        const char *e = eol ;
+        while (e > s && isspace ((unsigned char) e [-1])) e-- ;
+        if (e - s > MAXLINE - 1) return (MM_line_too_long) ;
+
+        // get the row and column index
+        uint64_t i, j ;
+        const char *q = s ;
+        if (!mm_parse_uint64 (&q, eol, &i) || !mm_parse_uint64 (&q, eol, &j))
+        {
+            return (MM_bad_indices) ;
+        }
+
+        // check the indices (they are 1-based in the MM file format)
+        (*err_index) = i ;
+        if (i < 1 || i > nrows) return (MM_bad_row) ;
+        (*err_index) = j ;
+        if (j < 1 || j > ncols) return (MM_bad_col) ;
+
+        // advance q to the 3rd token to get the value of the entry
+        q = s ;
+        while (q < eol &&  MM_SPACE (*q)) q++ ;     // skip any leading spaces
+        while (q < eol && !MM_SPACE (*q)) q++ ;     // skip the row index
+        while (q < eol &&  MM_SPACE (*q)) q++ ;     // skip any spaces
+        while (q < eol && !MM_SPACE (*q)) q++ ;     // skip the column index
+
+        // read the value of the entry
+        if (!mm_parse_entry (q, eol, type, structural, X + k * typesize))
+        {
+            return (MM_bad_value) ;
+        }
+
+        // convert from 1-based to 0-based
+        I [k] = i - 1 ;
+        J [k] = j - 1 ;
+        k++ ;
+    }
+    return (MM_entry_ok) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_MMRead
+//------------------------------------------------------------------------------
+
+int LAGr_MMRead
 (
     // output:
     GrB_Matrix *A,  // handle of matrix to create
     // input:
     FILE *f,        // file to read from, already open
+    size_t blocksize,   // if > 0: read coordinate files in blocks of this
+                        // many bytes, and parse them in parallel.
+                        // If zero: read the file one line at a time.
     char *msg
 )
 {
@@ -409,6 +853,8 @@ int LAGraph_MMRead
 
     GrB_Index *I = NULL, *J = NULL ;
     uint8_t *X = NULL ;
+    char *Block = NULL ;
+    int64_t *Work = NULL ;
     LG_CLEAR_MSG ;
     LG_ASSERT (A != NULL, GrB_NULL_POINTER) ;
     LG_ASSERT (f != NULL, GrB_NULL_POINTER) ;
@@ -857,129 +1303,350 @@ int LAGraph_MMRead
     LG_TRY (LAGraph_Malloc ((void **) &X, nvals3, typesize, msg)) ;
 
     //--------------------------------------------------------------------------
-    // read in the triplets
+    // read in the triplets in large blocks, and parse them in parallel
     //--------------------------------------------------------------------------
 
-    GrB_Index i = -1, j = 0 ;
     GrB_Index nvals2 = 0 ;
-    for (int64_t k = 0 ; k < nvals ; k++)
+
+    if (MM_fmt == MM_coordinate && blocksize > 0)
     {
 
         //----------------------------------------------------------------------
-        // get the next triplet, skipping blank lines and comment lines
+        // allocate workspace
+        //----------------------------------------------------------------------
+
+        int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+        nthreads = LAGRAPH_MAX (nthreads, 1) ;
+        int ntasks_max = 4 * nthreads ;
+        LG_TRY (LAGraph_Malloc ((void **) &Work, 6 * (ntasks_max + 1),
+            sizeof (int64_t), msg)) ;
+        int64_t *Slice    = Work ;                          // chunk boundaries
+        int64_t *Line     = Work +     (ntasks_max + 1) ;   // # lines, 1st line
+        int64_t *Entry    = Work + 2 * (ntasks_max + 1) ;   // # entries, 1st k
+        int64_t *Status   = Work + 3 * (ntasks_max + 1) ;   // MM_entry_status
+        int64_t *Err_line = Work + 4 * (ntasks_max + 1) ;   // line of error
+        GrB_Index *Err_index = (GrB_Index *) (Work + 5 * (ntasks_max + 1)) ;
+
+        size_t Block_size = blocksize ;
+        LG_TRY (LAGraph_Malloc ((void **) &Block, Block_size, sizeof (char),
+            msg)) ;
+
+        //----------------------------------------------------------------------
+        // read and parse each block of the file
         //----------------------------------------------------------------------
 
-        uint8_t x [MAXLINE] ;       // scalar value
+        GrB_Index k = 0 ;       // # of entries read so far
+        size_t len = 0 ;        // # of bytes held in the Block
+        bool eof = false ;
 
-        while (true)
+        while (k < nvals && !eof)
         {
 
             //------------------------------------------------------------------
-            // read the file until finding the next triplet
+            // fill the Block, doubling its size if it holds a partial line
             //------------------------------------------------------------------
 
-            bool ok = get_line (f, buf) ;
-            line++ ;
-            LG_ASSERT_MSG (ok, LAGRAPH_IO_ERROR, "premature EOF") ;
-            if (is_blank_line (buf))
+            if (len == Block_size)
             {
-                // blank line or comment
-                continue ;
+                LG_TRY (LAGraph_Realloc ((void **) &Block, 2 * Block_size,
+                    Block_size, sizeof (char), msg)) ;
+                Block_size *= 2 ;
+            }
+            size_t nread = fread (Block + len, sizeof (char), Block_size - len,
+                f) ;
+            eof = (nread < Block_size - len) ;
+            len += nread ;
+
+            // find the end of the last complete line in the Block
+            size_t nbytes = len ;
+            if (!eof)
+            {
+                while (nbytes > 0 && Block [nbytes-1] != '\n') nbytes-- ;
+                if (nbytes == 0) continue ;
             }
 
             //------------------------------------------------------------------
-            // get the row and column index
+            // split Block [0..nbytes-1] into chunks at line boundaries
             //------------------------------------------------------------------
 
-            char *p = buf ;
-            if (MM_fmt == MM_array)
+            int ntasks = (int) LAGRAPH_MIN ((size_t) ntasks_max,
+                nbytes / LG_MM_CHUNK) ;
+            ntasks = LAGRAPH_MAX (ntasks, 1) ;
+            Slice [0] = 0 ;
+            for (int tid = 1 ; tid < ntasks ; tid++)
             {
-                // array format, column major order
-                i++ ;
-                if (i == nrows)
+                int64_t p = LG_PART (tid, nbytes, ntasks) ;
+                p = LAGRAPH_MAX (p, Slice [tid-1]) ;
+                while (p > 0 && p < (int64_t) nbytes && Block [p-1] != '\n')
                 {
-                    j++ ;
-                    if (MM_storage == MM_general)
-                    {
-                        // dense matrix in column major order
-                        i = 0 ;
-                    }
-                    else
-                    {
-                        // dense matrix in column major order, only the lower
-                        // triangular form is present, including the diagonal
-                        i = j ;
-                    }
+                    p++ ;
                 }
+                Slice [tid] = p ;
             }
-            else
+            Slice [ntasks] = nbytes ;
+
+            //------------------------------------------------------------------
+            // count the lines and entries in each chunk
+            //------------------------------------------------------------------
+
+            int64_t tid ;
+            #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+            for (tid = 0 ; tid < ntasks ; tid++)
             {
-                // coordinate format; read the row index and column index
-                int inputs = sscanf (p, "%" SCNu64 " %" SCNu64, &i, &j) ;
-                LG_ASSERT_MSGF (inputs == 2, LAGRAPH_IO_ERROR,
-                    "line %" PRId64 " of input file: indices invalid", line) ;
-                // check the indices (they are 1-based in the MM file format)
-                LG_ASSERT_MSGF (i >= 1 && i <= nrows, GrB_INDEX_OUT_OF_BOUNDS,
+                mm_count_chunk (Block + Slice [tid], Block + Slice [tid+1],
+                    &Line [tid], &Entry [tid]) ;
+            }
+
+            // cumulative sum to find the first line and entry of each chunk
+            int64_t nlines = line + 1 ;
+            GrB_Index nentries = k ;
+            for (tid = 0 ; tid < ntasks ; tid++)
+            {
+                int64_t nl = Line [tid] ;
+                int64_t ne = Entry [tid] ;
+                Line  [tid] = nlines ;
+                Entry [tid] = nentries ;
+                nlines += nl ;
+                nentries += ne ;
+            }
+
+            //------------------------------------------------------------------
+            // parse each chunk
+            //------------------------------------------------------------------
+
+            #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+            for (tid = 0 ; tid < ntasks ; tid++)
+            {
+                Status [tid] = mm_parse_chunk (Block + Slice [tid],
+                    Block + Slice [tid+1], Line [tid], Entry [tid], nvals,
+                    nrows, ncols, type, typesize, MM_type == MM_pattern,
+                    I, J, X, &Err_line [tid], &Err_index [tid]) ;
+            }
+
+            //------------------------------------------------------------------
+            // report the first error in the file, if any
+            //------------------------------------------------------------------
+
+            for (tid = 0 ; tid < ntasks ; tid++)
+            {
+                MM_entry_status status = (MM_entry_status) Status [tid] ;
+                LG_ASSERT_MSGF (status != MM_bad_indices, LAGRAPH_IO_ERROR,
+                    "line %" PRId64 " of input file: indices invalid",
+                    Err_line [tid]) ;
+                LG_ASSERT_MSGF (status != MM_bad_row, GrB_INDEX_OUT_OF_BOUNDS,
                     "line %" PRId64 " of input file: row index %" PRIu64
                     " out of range (must be in range 1 to %" PRIu64")",
-                    line, i, nrows) ;
-                LG_ASSERT_MSGF (j >= 1 && j <= ncols, GrB_INDEX_OUT_OF_BOUNDS,
+                    Err_line [tid], Err_index [tid], nrows) ;
+                LG_ASSERT_MSGF (status != MM_bad_col, GrB_INDEX_OUT_OF_BOUNDS,
                     "line %" PRId64 " of input file: column index %" PRIu64
                     " out of range (must be in range 1 to %" PRIu64")",
-                    line, j, ncols) ;
-                // convert from 1-based to 0-based.
-                i-- ;
-                j-- ;
-                // advance p to the 3rd token to get the value of the entry
-                while (*p &&  isspace (*p)) p++ ;   // skip any leading spaces
-                while (*p && !isspace (*p)) p++ ;   // skip the row index
-                while (*p &&  isspace (*p)) p++ ;   // skip any spaces
-                while (*p && !isspace (*p)) p++ ;   // skip the column index
+                    Err_line [tid], Err_index [tid], ncols) ;
+                LG_ASSERT_MSGF (status != MM_bad_value, LAGRAPH_IO_ERROR,
+                    "entry value invalid on line %" PRId64 " of input file",
+                    Err_line [tid]) ;
+                LG_ASSERT_MSGF (status != MM_line_too_long, LAGRAPH_IO_ERROR,
+                    "line %" PRId64 " of input file: line too long",
+                    Err_line [tid]) ;
             }
 
             //------------------------------------------------------------------
-            // read the value of the entry
+            // keep the partial last line for the next block
             //------------------------------------------------------------------
 
-            while (*p && isspace (*p)) p++ ;        // skip any spaces
+            line = nlines - 1 ;
+            k = LAGRAPH_MIN (nentries, nvals) ;
+            len -= nbytes ;
+            memmove (Block, Block + nbytes, len) ;
+        }
 
-            ok = read_entry (p, type, MM_type == MM_pattern, x) ;
-            LG_ASSERT_MSGF (ok, LAGRAPH_IO_ERROR, "entry value invalid on line"
-                " %" PRId64 " of input file", line) ;
+        LG_ASSERT_MSG (k == nvals, LAGRAPH_IO_ERROR, "premature EOF") ;
+        nvals2 = nvals ;
 
-            //------------------------------------------------------------------
-            // set the value in the matrix
-            //------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        // add the A(j,i) entries if the matrix is symmetric or skew-symmetric
+        //----------------------------------------------------------------------
 
-            set_value (typesize, i, j, x, I, J, X, &nvals2) ;
+        if (MM_storage != MM_general)
+        {
+            // count the off-diagonal entries in each slice of the triplets
+            int64_t tid ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (tid = 0 ; tid < nthreads ; tid++)
+            {
+                int64_t k1, k2 ;
+                LG_PARTITION (k1, k2, (int64_t) nvals, tid, nthreads) ;
+                int64_t noffdiag = 0 ;
+                for (int64_t p = k1 ; p < k2 ; p++)
+                {
+                    noffdiag += (I [p] != J [p]) ;
+                }
+                Entry [tid] = noffdiag ;
+            }
 
-            //------------------------------------------------------------------
-            // also set the A(j,i) entry, if symmetric
-            //------------------------------------------------------------------
+            // cumulative sum to find where each slice places its new entries
+            for (tid = 0 ; tid < nthreads ; tid++)
+            {
+                int64_t noffdiag = Entry [tid] ;
+                Entry [tid] = nvals2 ;
+                nvals2 += noffdiag ;
+            }
 
-            if (i != j && MM_storage != MM_general)
+            // append the A(j,i) entries after the entries read from the file
+            bool skew = (MM_storage == MM_skew_symmetric) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (tid = 0 ; tid < nthreads ; tid++)
             {
-                if (MM_storage == MM_symmetric)
+                int64_t k1, k2 ;
+                LG_PARTITION (k1, k2, (int64_t) nvals, tid, nthreads) ;
+                int64_t pnew = Entry [tid] ;
+                for (int64_t p = k1 ; p < k2 ; p++)
                 {
-                    set_value (typesize, j, i, x, I, J, X, &nvals2) ;
+                    if (I [p] == J [p]) continue ;
+                    I [pnew] = J [p] ;
+                    J [pnew] = I [p] ;
+                    uint8_t *x = X + pnew * typesize ;
+                    memcpy (x, X + p * typesize, typesize) ;
+                    if (skew) negate_scalar (type, x) ;
+                    pnew++ ;
                 }
-                else if (MM_storage == MM_skew_symmetric)
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // read in the triplets one line at a time
+        //----------------------------------------------------------------------
+
+        GrB_Index i = -1, j = 0 ;
+        for (int64_t k = 0 ; k < (int64_t) nvals ; k++)
+        {
+
+            //----------------------------------------------------------------------
+            // get the next triplet, skipping blank lines and comment lines
+            //----------------------------------------------------------------------
+
+            uint8_t x [MAXLINE] ;       // scalar value
+
+            while (true)
+            {
+
+                //------------------------------------------------------------------
+                // read the file until finding the next triplet
+                //------------------------------------------------------------------
+
+                bool ok = get_line (f, buf) ;
+                line++ ;
+                LG_ASSERT_MSG (ok, LAGRAPH_IO_ERROR, "premature EOF") ;
+                if (is_blank_line (buf))
                 {
-                    negate_scalar (type, x) ;
-                    set_value (typesize, j, i, x, I, J, X, &nvals2) ;
+                    // blank line or comment; discard the rest of a comment
+                    // that does not fit in buf, as LAGr_MMRead does when
+                    // reading in blocks
+                    if (buf [0] == '%' && strchr (buf, '\n') == NULL)
+                    {
+                        int c ;
+                        while ((c = fgetc (f)) != EOF && c != '\n') ;
+                    }
+                    continue ;
                 }
-                #if 0
-                else if (MM_storage == MM_hermitian)
+
+                //------------------------------------------------------------------
+                // get the row and column index
+                //------------------------------------------------------------------
+
+                char *p = buf ;
+                if (MM_fmt == MM_array)
                 {
-                    double complex *value = (double complex *) x ;
-                    (*value) = conj (*value) ;
-                    set_value (typesize, j, i, x, I, J, X, &nvals2) ;
+                    // array format, column major order
+                    i++ ;
+                    if (i == nrows)
+                    {
+                        j++ ;
+                        if (MM_storage == MM_general)
+                        {
+                            // dense matrix in column major order
+                            i = 0 ;
+                        }
+                        else
+                        {
+                            // dense matrix in column major order, only the lower
+                            // triangular form is present, including the diagonal
+                            i = j ;
+                        }
+                    }
+                }
+                else
+                {
+                    // coordinate format; read the row index and column index
+                    int inputs = sscanf (p, "%" SCNu64 " %" SCNu64, &i, &j) ;
+                    LG_ASSERT_MSGF (inputs == 2, LAGRAPH_IO_ERROR,
+                        "line %" PRId64 " of input file: indices invalid", line) ;
+                    // check the indices (they are 1-based in the MM file format)
+                    LG_ASSERT_MSGF (i >= 1 && i <= nrows, GrB_INDEX_OUT_OF_BOUNDS,
+                        "line %" PRId64 " of input file: row index %" PRIu64
+                        " out of range (must be in range 1 to %" PRIu64")",
+                        line, i, nrows) ;
+                    LG_ASSERT_MSGF (j >= 1 && j <= ncols, GrB_INDEX_OUT_OF_BOUNDS,
+                        "line %" PRId64 " of input file: column index %" PRIu64
+                        " out of range (must be in range 1 to %" PRIu64")",
+                        line, j, ncols) ;
+                    // convert from 1-based to 0-based.
+                    i-- ;
+                    j-- ;
+                    // advance p to the 3rd token to get the value of the entry
+                    while (*p &&  isspace (*p)) p++ ;   // skip any leading spaces
+                    while (*p && !isspace (*p)) p++ ;   // skip the row index
+                    while (*p &&  isspace (*p)) p++ ;   // skip any spaces
+                    while (*p && !isspace (*p)) p++ ;   // skip the column index
                 }
-                #endif
-            }
 
-            // one more entry has been read in
-            break ;
+                //------------------------------------------------------------------
+                // read the value of the entry
+                //------------------------------------------------------------------
+
+                while (*p && isspace (*p)) p++ ;        // skip any spaces
+
+                ok = read_entry (p, type, MM_type == MM_pattern, x) ;
+                LG_ASSERT_MSGF (ok, LAGRAPH_IO_ERROR, "entry value invalid on line"
+                    " %" PRId64 " of input file", line) ;
+
+                //------------------------------------------------------------------
+                // set the value in the matrix
+                //------------------------------------------------------------------
+
+                set_value (typesize, i, j, x, I, J, X, &nvals2) ;
+
+                //------------------------------------------------------------------
+                // also set the A(j,i) entry, if symmetric
+                //------------------------------------------------------------------
+
+                if (i != j && MM_storage != MM_general)
+                {
+                    if (MM_storage == MM_symmetric)
+                    {
+                        set_value (typesize, j, i, x, I, J, X, &nvals2) ;
+                    }
+                    else if (MM_storage == MM_skew_symmetric)
+                    {
+                        negate_scalar (type, x) ;
+                        set_value (typesize, j, i, x, I, J, X, &nvals2) ;
+                    }
+                    #if 0
+                    else if (MM_storage == MM_hermitian)
+                    {
+                        double complex *value = (double complex *) x ;
+                        (*value) = conj (*value) ;
+                        set_value (typesize, j, i, x, I, J, X, &nvals2) ;
+                    }
+                    #endif
+                }
+
+                // one more entry has been read in
+                break ;
+            }
         }
     }
 
@@ -1049,3 +1716,19 @@ int LAGraph_MMRead
     LG_FREE_WORK ;
     return (GrB_SUCCESS) ;
 }
+
+//------------------------------------------------------------------------------
+// LAGraph_MMRead
+//------------------------------------------------------------------------------
+
+int LAGraph_MMRead
+(
+    // output:
+    GrB_Matrix *A,  // handle of matrix to create
+    // input:
+    FILE *f,        // file to read from, already open
+    char *msg
+)
+{
+    return (LAGr_MMRead (A, f, 0, msg)) ;
+}
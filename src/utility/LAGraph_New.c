@@ -68,6 +68,11 @@ int LAGraph_New
     (*G)->emin_state = LAGRAPH_UNKNOWN ;
     (*G)->emax = NULL ;
     (*G)->emax_state = LAGRAPH_UNKNOWN ;
+    (*G)->bfs_alpha = LAGRAPH_UNKNOWN ;
+    (*G)->bfs_beta1 = LAGRAPH_UNKNOWN ;
+    (*G)->bfs_beta2 = LAGRAPH_UNKNOWN ;
+    (*G)->tc_method = LAGRAPH_UNKNOWN ;
+    (*G)->tc_presort = LAGr_TriangleCount_AutoSort ;
 
     //--------------------------------------------------------------------------
     // assign its primary components
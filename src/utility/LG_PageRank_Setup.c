@@ -0,0 +1,122 @@
+//------------------------------------------------------------------------------
+// LG_PageRank_Setup: get the matrix, scaled degrees, and sinks for PageRank
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LG_PageRank_Setup does the work shared by the PageRank variants
+// (LAGraph_PageRankSolver, LAGraph_PersonalizedPageRank, LAGraph_PageRankTyped,
+// and LAGraph_PageRankIncremental), as done in LAGr_PageRank.  It selects the
+// matrix AT to multiply with (G->A if its structure is symmetric, or G->AT
+// otherwise, which must be cached), and checks that G->out_degree is cached.
+
+// It creates d = max (d_out / damping, 1 / damping) of the given type, so the
+// iterations can compute w = r./d without scaling by the damping factor each
+// time.  d must be GrB_FP32 or GrB_FP64, and it is computed in the precision
+// of its type, so that an FP32 d is the same as the one used by LAGr_PageRank.
+
+// If sink is not NULL, the sinks are found: sink(i) = true if node i has
+// d_out(i) = 0, or d_out(i) not present.  sink is returned as NULL if the
+// graph has no sinks.
+
+#define LG_FREE_ALL                         \
+{                                           \
+    GrB_free (d) ;                          \
+    if (sink != NULL)                       \
+    {                                       \
+        GrB_free (sink) ;                   \
+    }                                       \
+}
+
+#include "LG_internal.h"
+
+int LG_PageRank_Setup
+(
+    // output:
+    GrB_Matrix *AT,             // G->A or G->AT, not to be freed
+    GrB_Vector *d,              // d = max (d_out / damping, 1 / damping)
+    GrB_Vector *sink,           // the sinks of G (optional; may be NULL)
+    GrB_Index *nsinks,          // # of sinks of G (0 if sink is NULL)
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Type type,              // type of d: GrB_FP32 or GrB_FP64
+    double damping,             // damping factor
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LG_ASSERT (AT != NULL && d != NULL && nsinks != NULL, GrB_NULL_POINTER) ;
+    (*AT) = NULL ;
+    (*d) = NULL ;
+    (*nsinks) = 0 ;
+    if (sink != NULL) (*sink) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE)
+    {
+        // A and A' have the same structure
+        (*AT) = G->A ;
+    }
+    else
+    {
+        // A and A' differ
+        (*AT) = G->AT ;
+        LG_ASSERT_MSG ((*AT) != NULL, LAGRAPH_NOT_CACHED,
+            "G->AT is required") ;
+    }
+    GrB_Vector d_out = G->out_degree ;
+    LG_ASSERT_MSG (d_out != NULL,
+        LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+
+    //--------------------------------------------------------------------------
+    // find all sinks, if requested
+    //--------------------------------------------------------------------------
+
+    if (sink != NULL)
+    {
+        GrB_Index nvals ;
+        GRB_TRY (GrB_Vector_nvals (&nvals, d_out)) ;
+        (*nsinks) = n - nvals ;
+        if ((*nsinks) > 0)
+        {
+            // sink<!struct(d_out)> = true
+            GRB_TRY (GrB_Vector_new (sink, GrB_BOOL, n)) ;
+            GRB_TRY (GrB_assign ((*sink), d_out, NULL, (bool) true, GrB_ALL,
+                n, GrB_DESC_SC)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // d = max (d_out / damping, 1 / damping)
+    //--------------------------------------------------------------------------
+
+    LG_ASSERT_MSG (type == GrB_FP32 || type == GrB_FP64, GrB_NOT_IMPLEMENTED,
+        "type not supported") ;
+    GrB_BinaryOp max_op = (type == GrB_FP32) ? GrB_MAX_FP32 : GrB_MAX_FP64 ;
+    GrB_BinaryOp div_op = (type == GrB_FP32) ? GrB_DIV_FP32 : GrB_DIV_FP64 ;
+    GRB_TRY (GrB_Vector_new (d, type, n)) ;
+    GRB_TRY (GrB_assign ((*d), NULL, NULL, 1.0 / damping, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_apply ((*d), NULL, max_op, div_op, d_out, damping, NULL)) ;
+
+    return (GrB_SUCCESS) ;
+}
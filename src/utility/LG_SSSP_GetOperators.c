@@ -0,0 +1,205 @@
+//------------------------------------------------------------------------------
+// LG_SSSP_GetOperators: select the operators for a shortest-path method
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LG_SSSP_GetOperators selects the operators used by the delta-stepping
+// methods (LG_SingleSourceShortestPath, LAGraph_MultiSourceSSSP, and
+// LAGraph_PointToPointSSSP), for the type of G->A.  It also creates the
+// infinity scalar, of that type, which is the path length of a node that is
+// not reachable, and checks G->emin to see if the graph may have negative
+// edge weights.
+
+#define LG_FREE_ALL                         \
+{                                           \
+    if (infinity != NULL)                   \
+    {                                       \
+        GrB_free (infinity) ;               \
+    }                                       \
+}
+
+#include "LG_internal.h"
+
+int LG_SSSP_GetOperators
+(
+    // output:
+    LG_SSSP_Operators *ops,     // operators for the type of G->A
+    GrB_Scalar *infinity,       // path length of unreachable nodes (optional;
+                                // may be NULL)
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    if (infinity != NULL) (*infinity) = NULL ;
+    LG_ASSERT (ops != NULL, GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // get the type of G->A
+    //--------------------------------------------------------------------------
+
+    GrB_Type etype ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, G->A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&etype, typename, msg)) ;
+    ops->type = etype ;
+    ops->negative_edge_weights = true ;
+
+    //--------------------------------------------------------------------------
+    // select the operators
+    //--------------------------------------------------------------------------
+
+    if (etype == GrB_INT32)
+    {
+        ops->tcode = 0 ;
+        ops->infinity = (double) INT32_MAX ;
+        ops->ne = GrB_VALUENE_INT32 ;
+        ops->le = GrB_VALUELE_INT32 ;
+        ops->ge = GrB_VALUEGE_INT32 ;
+        ops->lt = GrB_VALUELT_INT32 ;
+        ops->gt = GrB_VALUEGT_INT32 ;
+        ops->less_than = GrB_LT_INT32 ;
+        ops->eq = GrB_EQ_INT32 ;
+        ops->min_plus = GrB_MIN_PLUS_SEMIRING_INT32 ;
+        ops->min_second = GrB_MIN_SECOND_SEMIRING_INT32 ;
+    }
+    else if (etype == GrB_INT64)
+    {
+        ops->tcode = 1 ;
+        ops->infinity = (double) INT64_MAX ;
+        ops->ne = GrB_VALUENE_INT64 ;
+        ops->le = GrB_VALUELE_INT64 ;
+        ops->ge = GrB_VALUEGE_INT64 ;
+        ops->lt = GrB_VALUELT_INT64 ;
+        ops->gt = GrB_VALUEGT_INT64 ;
+        ops->less_than = GrB_LT_INT64 ;
+        ops->eq = GrB_EQ_INT64 ;
+        ops->min_plus = GrB_MIN_PLUS_SEMIRING_INT64 ;
+        ops->min_second = GrB_MIN_SECOND_SEMIRING_INT64 ;
+    }
+    else if (etype == GrB_UINT32)
+    {
+        ops->tcode = 2 ;
+        ops->infinity = (double) UINT32_MAX ;
+        ops->ne = GrB_VALUENE_UINT32 ;
+        ops->le = GrB_VALUELE_UINT32 ;
+        ops->ge = GrB_VALUEGE_UINT32 ;
+        ops->lt = GrB_VALUELT_UINT32 ;
+        ops->gt = GrB_VALUEGT_UINT32 ;
+        ops->less_than = GrB_LT_UINT32 ;
+        ops->eq = GrB_EQ_UINT32 ;
+        ops->min_plus = GrB_MIN_PLUS_SEMIRING_UINT32 ;
+        ops->min_second = GrB_MIN_SECOND_SEMIRING_UINT32 ;
+        ops->negative_edge_weights = false ;
+    }
+    else if (etype == GrB_UINT64)
+    {
+        ops->tcode = 3 ;
+        ops->infinity = (double) UINT64_MAX ;
+        ops->ne = GrB_VALUENE_UINT64 ;
+        ops->le = GrB_VALUELE_UINT64 ;
+        ops->ge = GrB_VALUEGE_UINT64 ;
+        ops->lt = GrB_VALUELT_UINT64 ;
+        ops->gt = GrB_VALUEGT_UINT64 ;
+        ops->less_than = GrB_LT_UINT64 ;
+        ops->eq = GrB_EQ_UINT64 ;
+        ops->min_plus = GrB_MIN_PLUS_SEMIRING_UINT64 ;
+        ops->min_second = GrB_MIN_SECOND_SEMIRING_UINT64 ;
+        ops->negative_edge_weights = false ;
+    }
+    else if (etype == GrB_FP32)
+    {
+        ops->tcode = 4 ;
+        ops->infinity = INFINITY ;
+        ops->ne = GrB_VALUENE_FP32 ;
+        ops->le = GrB_VALUELE_FP32 ;
+        ops->ge = GrB_VALUEGE_FP32 ;
+        ops->lt = GrB_VALUELT_FP32 ;
+        ops->gt = GrB_VALUEGT_FP32 ;
+        ops->less_than = GrB_LT_FP32 ;
+        ops->eq = GrB_EQ_FP32 ;
+        ops->min_plus = GrB_MIN_PLUS_SEMIRING_FP32 ;
+        ops->min_second = GrB_MIN_SECOND_SEMIRING_FP32 ;
+    }
+    else if (etype == GrB_FP64)
+    {
+        ops->tcode = 5 ;
+        ops->infinity = INFINITY ;
+        ops->ne = GrB_VALUENE_FP64 ;
+        ops->le = GrB_VALUELE_FP64 ;
+        ops->ge = GrB_VALUEGE_FP64 ;
+        ops->lt = GrB_VALUELT_FP64 ;
+        ops->gt = GrB_VALUEGT_FP64 ;
+        ops->less_than = GrB_LT_FP64 ;
+        ops->eq = GrB_EQ_FP64 ;
+        ops->min_plus = GrB_MIN_PLUS_SEMIRING_FP64 ;
+        ops->min_second = GrB_MIN_SECOND_SEMIRING_FP64 ;
+    }
+    else
+    {
+        LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED, "type not supported") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check if the graph might have negative (or zero) edge weights
+    //--------------------------------------------------------------------------
+
+    double emin = -1 ;
+    if (G->emin != NULL &&
+        (G->emin_state == LAGraph_VALUE ||
+         G->emin_state == LAGraph_BOUND))
+    {
+        GRB_TRY (GrB_Scalar_extractElement_FP64 (&emin, G->emin)) ;
+    }
+    if (ops->negative_edge_weights)
+    {
+        ops->negative_edge_weights = (emin < 0) ;
+    }
+    ops->positive_edge_weights = (emin > 0) ;
+
+    //--------------------------------------------------------------------------
+    // create the infinity scalar, if requested
+    //--------------------------------------------------------------------------
+
+    if (infinity != NULL)
+    {
+        GRB_TRY (GrB_Scalar_new (infinity, etype)) ;
+        switch (ops->tcode)
+        {
+            default:
+            case 0 : GRB_TRY (GrB_Scalar_setElement_INT32 ((*infinity),
+                        INT32_MAX)) ; break ;
+            case 1 : GRB_TRY (GrB_Scalar_setElement_INT64 ((*infinity),
+                        INT64_MAX)) ; break ;
+            case 2 : GRB_TRY (GrB_Scalar_setElement_UINT32 ((*infinity),
+                        UINT32_MAX)) ; break ;
+            case 3 : GRB_TRY (GrB_Scalar_setElement_UINT64 ((*infinity),
+                        UINT64_MAX)) ; break ;
+            case 4 : GRB_TRY (GrB_Scalar_setElement_FP32 ((*infinity),
+                        INFINITY)) ; break ;
+            case 5 : GRB_TRY (GrB_Scalar_setElement_FP64 ((*infinity),
+                        INFINITY)) ; break ;
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
@@ -614,9 +614,74 @@ int LG_KindName
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LG_SSSP_GetOperators: select the operators for a shortest-path method
+//------------------------------------------------------------------------------
+
+// The operators used by the delta-stepping methods, for the type of G->A,
+// which must be GrB_INT32, GrB_INT64, GrB_UINT32, GrB_UINT64, GrB_FP32, or
+// GrB_FP64.
+
+typedef struct
+{
+    GrB_Type type ;             // type of G->A
+    int tcode ;                 // 0 to 5, for the type of G->A: INT32, INT64,
+                                // UINT32, UINT64, FP32, FP64
+    double infinity ;           // path length of unreachable nodes, as a
+                                // double (INFINITY for FP32 and FP64)
+    GrB_IndexUnaryOp ne, le, ge, lt, gt ;   // compare an entry with a scalar
+    GrB_BinaryOp less_than, eq ;
+    GrB_Semiring min_plus, min_second ;
+    bool negative_edge_weights ;    // true if G->A may have negative entries
+    bool positive_edge_weights ;    // true if all entries are known to be > 0
+}
+LG_SSSP_Operators ;
+
+int LG_SSSP_GetOperators
+(
+    // output:
+    LG_SSSP_Operators *ops,     // operators for the type of G->A
+    GrB_Scalar *infinity,       // path length of unreachable nodes (optional;
+                                // may be NULL)
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LG_PageRank_Setup: get the matrix, scaled degrees, and sinks for PageRank
+//------------------------------------------------------------------------------
+
+// The setup shared by the PageRank variants: AT is G->A if its structure is
+// symmetric, or G->AT otherwise; d = max (d_out / damping, 1 / damping); and
+// sink(i) = true for each node i with no out-edges (sink is NULL if there are
+// none, or if not requested).
+
+int LG_PageRank_Setup
+(
+    // output:
+    GrB_Matrix *AT,             // G->A or G->AT, not to be freed
+    GrB_Vector *d,              // d = max (d_out / damping, 1 / damping)
+    GrB_Vector *sink,           // the sinks of G (optional; may be NULL)
+    GrB_Index *nsinks,          // # of sinks of G (0 if sink is NULL)
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Type type,              // type of d: GrB_FP32 or GrB_FP64
+    double damping,             // damping factor
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 
 // # of entries to print for LAGraph_Matrix_Print and LAGraph_Vector_Print
 #define LG_SHORT_LEN 30
 
+//------------------------------------------------------------------------------
+
+// default thresholds for the push/pull heuristic of the BFS, used if they have
+// not been calibrated for the graph (see LAGraph_BreadthFirstSearch_Calibrate)
+#define LG_BFS_ALPHA 8.0
+#define LG_BFS_BETA1 8.0
+#define LG_BFS_BETA2 512.0
+
 #endif